@@ -0,0 +1,694 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Host benchmark for the NMEA->Data Model->MQTT path. A capture file of NMEA 0183 lines is replayed
+// through an NMEASource, the resulting messages are bridged into the Data Model, and the Data Model
+// publishes are delivered by the real MQTTBroker to a subscriber on the loopback interface that
+// has subscribed to '#'.
+//
+// Four passes are made:
+//   - The full pipeline, driven the same way as loop() in Luna_Mon.cpp, reporting lines/sec and
+//     MQTT publishes/sec as seen by the subscriber.
+//   - The same pipeline fed by two sources replaying the same capture through a shared duplicate
+//     suppressor, as when one instrument reaches us over both USB and WiFi, reporting how many
+//     messages made it through.
+//   - A synthetic AIS capture of Class A position reports from far more vessels than the AIS
+//     target table has slots, reporting how quickly sentences are decoded and tracked, and how
+//     many target publishes the table's rate limiting let through.
+//   - A per-stage breakdown over the capture, reporting the average nanoseconds per line spent framing and
+//     validating the line, parsing it into a message, bridging it into the Data Model, and having
+//     the broker publish the resulting changes to the subscriber.
+//
+// Usage: nmea_benchmark [capture file] [passes]
+//
+
+#include "NMEA/NMEASource.h"
+#include "NMEA/NMEALine.h"
+#include "NMEA/NMEAMessage.h"
+#include "NMEA/NMEAMessageHandler.h"
+#include "NMEA/NMEADuplicateSuppressor.h"
+
+#include "WiFiManager/WiFiManager.h"
+
+#include "MQTT/MQTTBroker.h"
+
+#include "DataModel/DataModel.h"
+
+#include "NMEADataModelBridge/NMEADataModelBridge.h"
+
+#include "AIS/AISDecoder.h"
+#include "AIS/AISTargetTable.h"
+
+#include "StatsManager/StatsManager.h"
+#include "StatsManager/StatsHolder.h"
+
+#include "Util/CharacterTools.h"
+#include "Util/Logger.h"
+
+#include <Arduino.h>
+#include <Stream.h>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+StatsManager statsManager;
+WiFiManager wifiManager;
+MQTTBroker mqttBroker(statsManager);
+DataModel dataModel(statsManager);
+NMEADataModelBridge nmeaDataModelBridge(statsManager);
+AISDecoder aisDecoder(statsManager);
+AISTargetTable aisTargetTable(statsManager);
+
+static const char *defaultCaptureFile = "test/GPSCapture.txt";
+static const unsigned defaultPasses = 200;
+static const uint16_t mqttPort = 1883;
+// How much input arrives on each source per loop in the duplicate sources benchmark.
+static const size_t duplicateSourceChunk = 64;
+// Number of distinct vessels in the synthetic AIS capture, and how many position reports each
+// sends per pass.
+static const uint32_t syntheticAISTargets = 512;
+static const unsigned syntheticAISReports = 8;
+
+static uint64_t nowNanoseconds() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+// A Stream that plays back an in memory copy of a capture file. Normally the whole capture is
+// available at once, but it can instead be paced so that input arrives a chunk at a time, the way
+// it would from a serial port.
+class ReplayStream : public Stream {
+    private:
+        const char *data;
+        size_t length;
+        size_t pos;
+        size_t arrived;
+
+    public:
+        ReplayStream(const char *data, size_t length)
+            : data(data), length(length), pos(0), arrived(length) {
+        }
+
+        void rewind() {
+            pos = 0;
+            arrived = length;
+        }
+
+        void rewindPaced() {
+            pos = 0;
+            arrived = 0;
+        }
+
+        void arrive(size_t bytes) {
+            arrived = min(length, arrived + bytes);
+        }
+
+        bool atEnd() const {
+            return pos == length;
+        }
+
+        virtual int available() override {
+            return (int)(arrived - pos);
+        }
+
+        virtual int read() override {
+            if (pos == arrived) {
+                return -1;
+            }
+            return (uint8_t)data[pos++];
+        }
+
+        virtual int peek() override {
+            if (pos == arrived) {
+                return -1;
+            }
+            return (uint8_t)data[pos];
+        }
+
+        virtual size_t readBytes(char *buffer, size_t readLength) override {
+            const size_t bytesToRead = min(readLength, arrived - pos);
+            memcpy(buffer, data + pos, bytesToRead);
+            pos += bytesToRead;
+            return bytesToRead;
+        }
+
+        virtual size_t write(__attribute__((unused)) uint8_t character) override {
+            return 0;
+        }
+
+        virtual size_t write(__attribute__((unused)) const uint8_t *buffer,
+                             __attribute__((unused)) size_t size) override {
+            return 0;
+        }
+
+        virtual void flush() override {
+        }
+};
+
+class MessageCounter : public NMEAMessageHandler {
+    public:
+        uint32_t messages;
+
+        MessageCounter() : messages(0) {
+        }
+
+        virtual void processMessage(__attribute__((unused)) NMEAMessage *message) override {
+            messages++;
+        }
+};
+
+// Sources and suppressors built for a single benchmark register themselves with the global
+// StatsManager, and have to come off it again before they go out of scope, or the next stats
+// harvest calls into a destroyed object. Declared after the holder so that it's destroyed first.
+class StatsHolderRegistration {
+    private:
+        StatsHolder &statsHolder;
+
+    public:
+        explicit StatsHolderRegistration(StatsHolder &statsHolder) : statsHolder(statsHolder) {
+        }
+
+        ~StatsHolderRegistration() {
+            statsManager.removeStatsHolder(&statsHolder);
+        }
+};
+
+// A minimal MQTT 3.1.1 client that subscribes to everything and counts the PUBLISH packets that
+// come back, without doing anything with them.
+class BenchmarkSubscriber {
+    private:
+        enum PacketState {
+            PACKET_FIXED_HEADER,
+            PACKET_REMAINING_LENGTH,
+            PACKET_BODY
+        };
+
+        int socketFD;
+        PacketState packetState;
+        uint8_t packetType;
+        uint32_t remainingLength;
+        uint32_t lengthMultiplier;
+
+        void send(const uint8_t *packet, size_t length) {
+            if (::send(socketFD, packet, length, MSG_NOSIGNAL) != (ssize_t)length) {
+                perror("Benchmark subscriber send");
+                exit(1);
+            }
+        }
+
+        void packetReceived() {
+            switch (packetType) {
+                case 2:
+                    connectAckReceived = true;
+                    break;
+                case 3:
+                    publishesReceived++;
+                    break;
+                case 9:
+                    subscribeAckReceived = true;
+                    break;
+            }
+            packetState = PACKET_FIXED_HEADER;
+        }
+
+        void processBytes(const uint8_t *bytes, size_t length) {
+            for (size_t pos = 0; pos < length; pos++) {
+                const uint8_t byte = bytes[pos];
+                switch (packetState) {
+                    case PACKET_FIXED_HEADER:
+                        packetType = byte >> 4;
+                        remainingLength = 0;
+                        lengthMultiplier = 1;
+                        packetState = PACKET_REMAINING_LENGTH;
+                        break;
+
+                    case PACKET_REMAINING_LENGTH:
+                        remainingLength += (byte & 0x7f) * lengthMultiplier;
+                        lengthMultiplier *= 128;
+                        if ((byte & 0x80) == 0) {
+                            if (remainingLength) {
+                                packetState = PACKET_BODY;
+                            } else {
+                                packetReceived();
+                            }
+                        }
+                        break;
+
+                    case PACKET_BODY:
+                        {
+                            const size_t bodyBytes = min(remainingLength, length - pos);
+                            remainingLength -= bodyBytes;
+                            pos += bodyBytes - 1;
+                            if (remainingLength == 0) {
+                                packetReceived();
+                            }
+                        }
+                        break;
+                }
+            }
+        }
+
+    public:
+        bool connectAckReceived;
+        bool subscribeAckReceived;
+        uint32_t publishesReceived;
+
+        BenchmarkSubscriber()
+            : socketFD(-1),
+              packetState(PACKET_FIXED_HEADER),
+              connectAckReceived(false),
+              subscribeAckReceived(false),
+              publishesReceived(0) {
+        }
+
+        void connect(uint16_t port) {
+            socketFD = socket(AF_INET, SOCK_STREAM, 0);
+            if (socketFD < 0) {
+                perror("Benchmark subscriber socket");
+                exit(1);
+            }
+
+            struct sockaddr_in address;
+            memset(&address, 0, sizeof(address));
+            address.sin_family = AF_INET;
+            address.sin_port = htons(port);
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            if (::connect(socketFD, (struct sockaddr *)&address, sizeof(address)) < 0) {
+                perror("Benchmark subscriber connect");
+                exit(1);
+            }
+
+            const int noDelay = 1;
+            setsockopt(socketFD, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+            // CONNECT with Clean Session, a ten minute keep alive and a Client ID of "bench".
+            const uint8_t connectPacket[] = {
+                0x10, 17,
+                0x00, 0x04, 'M', 'Q', 'T', 'T', 0x04, 0x02, 0x02, 0x58,
+                0x00, 0x05, 'b', 'e', 'n', 'c', 'h'
+            };
+            send(connectPacket, sizeof(connectPacket));
+        }
+
+        void subscribeToEverything() {
+            const uint8_t subscribePacket[] = {
+                0x82, 6,
+                0x00, 0x01,
+                0x00, 0x01, '#', 0x00
+            };
+            send(subscribePacket, sizeof(subscribePacket));
+        }
+
+        void drain() {
+            uint8_t buffer[4096];
+            ssize_t length;
+            while ((length = recv(socketFD, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+                processBytes(buffer, length);
+            }
+        }
+};
+
+static char *loadCapture(const char *path, size_t &length) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        exit(1);
+    }
+
+    fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char *data = (char *)malloc(length);
+    if (data == NULL || fread(data, 1, length, file) != length) {
+        fprintf(stderr, "Failed to read %s\n", path);
+        exit(1);
+    }
+    fclose(file);
+
+    return data;
+}
+
+static uint32_t countLines(const char *data, size_t length) {
+    uint32_t lines = 0;
+    for (size_t pos = 0; pos < length; pos++) {
+        if (data[pos] == '\n') {
+            lines++;
+        }
+    }
+    return lines;
+}
+
+static void serviceBrokerUntil(BenchmarkSubscriber &subscriber, bool &condition) {
+    const uint64_t giveUpTime = nowNanoseconds() + 5000000000ULL;
+    while (!condition) {
+        mqttBroker.service();
+        subscriber.drain();
+        if (nowNanoseconds() > giveUpTime) {
+            fprintf(stderr, "Timed out waiting for the MQTT Broker\n");
+            exit(1);
+        }
+    }
+}
+
+static void startBroker(BenchmarkSubscriber &subscriber) {
+    wifiManager.begin();
+    mqttBroker.begin(wifiManager);
+    // The native WiFi is always connected, the first service call notifies the broker which then
+    // starts listening.
+    wifiManager.service();
+
+    subscriber.connect(mqttPort);
+    serviceBrokerUntil(subscriber, subscriber.connectAckReceived);
+    subscriber.subscribeToEverything();
+    serviceBrokerUntil(subscriber, subscriber.subscribeAckReceived);
+
+    // Let any retained values sent as a result of the subscribe arrive before counting starts.
+    const uint64_t settleTime = nowNanoseconds() + 100000000ULL;
+    while (nowNanoseconds() < settleTime) {
+        mqttBroker.service();
+        subscriber.drain();
+    }
+}
+
+static void benchmarkPipeline(const char *capture, size_t captureLength, unsigned passes,
+                              BenchmarkSubscriber &subscriber) {
+    ReplayStream replayStream(capture, captureLength);
+    NMEASource nmeaSource(replayStream, sysNMEAUSBMessages, sysNMEAUSBMessageRate,
+                          sysNMEAUSBBacklog, sysNMEAUSBBudgetExhaustions,
+                          sysNMEAUSBOverlengthLines, statsManager);
+    StatsHolderRegistration nmeaSourceRegistration(nmeaSource);
+    MessageCounter messageCounter;
+    nmeaSource.addMessageHandler(messageCounter);
+    nmeaSource.addMessageHandler(nmeaDataModelBridge);
+
+    const uint32_t linesPerPass = countLines(capture, captureLength);
+    const uint32_t startingPublishes = subscriber.publishesReceived;
+
+    const uint64_t startTime = nowNanoseconds();
+    for (unsigned pass = 0; pass < passes; pass++) {
+        replayStream.rewind();
+        while (!replayStream.atEnd()) {
+            nmeaSource.service();
+            nmeaDataModelBridge.service();
+            mqttBroker.service();
+            statsManager.service();
+            subscriber.drain();
+        }
+    }
+    // Send whatever Data Model changes are still pending.
+    mqttBroker.service();
+    const uint64_t elapsed = nowNanoseconds() - startTime;
+    subscriber.drain();
+
+    const double seconds = elapsed / 1e9;
+    const uint64_t lines = (uint64_t)linesPerPass * passes;
+    const uint32_t publishes = subscriber.publishesReceived - startingPublishes;
+
+    printf("Full pipeline (%u passes of %u lines):\n", passes, linesPerPass);
+    printf("  %12.0f lines/sec\n", lines / seconds);
+    printf("  %12.0f messages/sec (%u messages)\n", messageCounter.messages / seconds,
+           messageCounter.messages);
+    printf("  %12.0f publishes/sec (%u publishes received)\n", publishes / seconds, publishes);
+    printf("  %12.1f ns/line\n", (double)elapsed / lines);
+}
+
+static void benchmarkDuplicateSources(const char *capture, size_t captureLength, unsigned passes,
+                                      BenchmarkSubscriber &subscriber) {
+    ReplayStream usbReplayStream(capture, captureLength);
+    ReplayStream wifiReplayStream(capture, captureLength);
+    NMEASource usbSource(usbReplayStream, sysNMEAUSBMessages, sysNMEAUSBMessageRate,
+                         sysNMEAUSBBacklog, sysNMEAUSBBudgetExhaustions,
+                         sysNMEAUSBOverlengthLines, statsManager);
+    NMEASource wifiSource(wifiReplayStream, sysNMEAWiFiMessages, sysNMEAWiFiMessageRate,
+                          sysNMEAWiFiBacklog, sysNMEAWiFiBudgetExhaustions,
+                          sysNMEAWiFiOverlengthLines, statsManager);
+    NMEADuplicateSuppressor duplicateSuppressor(statsManager);
+    StatsHolderRegistration usbSourceRegistration(usbSource);
+    StatsHolderRegistration wifiSourceRegistration(wifiSource);
+    StatsHolderRegistration duplicateSuppressorRegistration(duplicateSuppressor);
+    usbSource.setDuplicateSuppressor(duplicateSuppressor, sysNMEAUSBDuplicates, true);
+    wifiSource.setDuplicateSuppressor(duplicateSuppressor, sysNMEAWiFiDuplicates);
+    MessageCounter usbMessageCounter;
+    MessageCounter wifiMessageCounter;
+    usbSource.addMessageHandler(usbMessageCounter);
+    usbSource.addMessageHandler(nmeaDataModelBridge);
+    wifiSource.addMessageHandler(wifiMessageCounter);
+    wifiSource.addMessageHandler(nmeaDataModelBridge);
+
+    const uint32_t linesPerPass = countLines(capture, captureLength);
+
+    const uint64_t startTime = nowNanoseconds();
+    for (unsigned pass = 0; pass < passes; pass++) {
+        usbReplayStream.rewindPaced();
+        wifiReplayStream.rewindPaced();
+        while (!usbReplayStream.atEnd() || !wifiReplayStream.atEnd()) {
+            usbReplayStream.arrive(duplicateSourceChunk);
+            wifiReplayStream.arrive(duplicateSourceChunk);
+            usbSource.service();
+            wifiSource.service();
+            nmeaDataModelBridge.service();
+            mqttBroker.service();
+            statsManager.service();
+            subscriber.drain();
+        }
+    }
+    const uint64_t elapsed = nowNanoseconds() - startTime;
+    subscriber.drain();
+
+    const double seconds = elapsed / 1e9;
+    const uint64_t lines = (uint64_t)linesPerPass * passes * 2;
+
+    printf("Duplicate sources (%u passes of %u lines from each of two sources):\n", passes,
+           linesPerPass);
+    printf("  %12.0f lines/sec\n", lines / seconds);
+    printf("  %12u messages from the preferred source\n", usbMessageCounter.messages);
+    printf("  %12u messages from the other source\n", wifiMessageCounter.messages);
+    printf("  %12.1f ns/line\n", (double)elapsed / lines);
+}
+
+// Builds up an AIS payload a field at a time, armouring it six bits to a character.
+class AISPayloadBuilder {
+    private:
+        char payload[64];
+        size_t characters;
+        uint8_t pendingBits;
+        uint8_t pendingCount;
+
+    public:
+        AISPayloadBuilder() : characters(0), pendingBits(0), pendingCount(0) {
+        }
+
+        void add(uint32_t value, unsigned bitCount) {
+            while (bitCount--) {
+                pendingBits = (pendingBits << 1) | ((value >> bitCount) & 1);
+                if (++pendingCount == 6) {
+                    payload[characters++] = pendingBits < 40 ? pendingBits + 48 : pendingBits + 56;
+                    pendingBits = 0;
+                    pendingCount = 0;
+                }
+            }
+        }
+
+        const char *text() {
+            payload[characters] = 0;
+            return payload;
+        }
+};
+
+// Generates single sentence VDM type 1 position reports for a fleet of vessels, each report
+// moving every vessel a little.
+static char *syntheticAISCapture(size_t &length) {
+    const size_t maxSentenceLength = 82;
+    char *capture = (char *)malloc(maxSentenceLength * syntheticAISTargets * syntheticAISReports);
+    if (capture == NULL) {
+        fprintf(stderr, "Failed to allocate the synthetic AIS capture\n");
+        exit(1);
+    }
+
+    length = 0;
+    for (unsigned report = 0; report < syntheticAISReports; report++) {
+        for (uint32_t target = 0; target < syntheticAISTargets; target++) {
+            AISPayloadBuilder builder;
+            builder.add(1, 6);                                  // Message type
+            builder.add(0, 2);                                  // Repeat indicator
+            builder.add(366000000 + target * 7919, 30);         // MMSI
+            builder.add(0, 4);                                  // Navigation status
+            builder.add(0x80, 8);                               // Rate of turn not available
+            builder.add(50 + target % 100, 10);                 // Speed over ground
+            builder.add(1, 1);                                  // Position accuracy
+            builder.add((-122 * 60 * 10000 + target * 100 + report * 10) & 0xfffffff, 28);
+            builder.add((37 * 60 * 10000 + target * 100 + report * 10) & 0x7ffffff, 27);
+            builder.add((target * 7) % 3600, 12);               // Course over ground
+            builder.add(target % 360, 9);                       // True heading
+            builder.add(report, 6);                             // Time stamp
+            builder.add(0, 2 + 3 + 1 + 19);                     // Maneuver, spare, RAIM, radio
+
+            char sentence[maxSentenceLength];
+            snprintf(sentence, sizeof(sentence), "AIVDM,1,1,,A,%s,0", builder.text());
+            uint8_t checksum = 0;
+            for (const char *character = sentence; *character; character++) {
+                checksum ^= *character;
+            }
+            length += sprintf(capture + length, "!%s*%02X\r\n", sentence, checksum);
+        }
+    }
+
+    return capture;
+}
+
+static void benchmarkAISTargets(unsigned passes, BenchmarkSubscriber &subscriber) {
+    size_t captureLength;
+    char *capture = syntheticAISCapture(captureLength);
+
+    ReplayStream replayStream(capture, captureLength);
+    NMEASource nmeaSource(replayStream, sysNMEAUSBMessages, sysNMEAUSBMessageRate,
+                          sysNMEAUSBBacklog, sysNMEAUSBBudgetExhaustions,
+                          sysNMEAUSBOverlengthLines, statsManager);
+    StatsHolderRegistration nmeaSourceRegistration(nmeaSource);
+    nmeaSource.addMessageHandler(aisDecoder);
+
+    const uint32_t linesPerPass = countLines(capture, captureLength);
+    const uint32_t startingPublishes = subscriber.publishesReceived;
+
+    const uint64_t startTime = nowNanoseconds();
+    for (unsigned pass = 0; pass < passes; pass++) {
+        replayStream.rewind();
+        while (!replayStream.atEnd()) {
+            nmeaSource.service();
+            aisTargetTable.service();
+            mqttBroker.service();
+            statsManager.service();
+            subscriber.drain();
+        }
+    }
+    // Send whatever Data Model changes are still pending.
+    mqttBroker.service();
+    const uint64_t elapsed = nowNanoseconds() - startTime;
+    subscriber.drain();
+
+    const double seconds = elapsed / 1e9;
+    const uint64_t lines = (uint64_t)linesPerPass * passes;
+    const uint32_t publishes = subscriber.publishesReceived - startingPublishes;
+
+    printf("AIS targets (%u passes of %u reports from %u vessels, %u slots):\n", passes,
+           linesPerPass, syntheticAISTargets, (unsigned)aisMaxTargets);
+    printf("  %12.0f sentences/sec\n", lines / seconds);
+    printf("  %12.0f publishes/sec (%u publishes received)\n", publishes / seconds, publishes);
+    printf("  %12.1f ns/sentence\n", (double)elapsed / lines);
+
+    free(capture);
+}
+
+static void benchmarkStages(const char *capture, size_t captureLength, unsigned passes,
+                            BenchmarkSubscriber &subscriber) {
+    uint64_t frameNanoseconds = 0;
+    uint64_t parseNanoseconds = 0;
+    uint64_t logNanoseconds = 0;
+    uint64_t bridgeNanoseconds = 0;
+    uint64_t publishNanoseconds = 0;
+    uint64_t lines = 0;
+    NMEALine nmeaLine;
+
+    for (unsigned pass = 0; pass < passes; pass++) {
+        size_t lineStart = 0;
+        while (lineStart < captureLength) {
+            const uint64_t frameStart = nowNanoseconds();
+            uint8_t lineXOR = 0;
+            const char *lineEnd = findCharacterWithXOR(capture + lineStart,
+                                                       capture + captureLength, '\r', lineXOR);
+            if (lineEnd == capture + captureLength) {
+                break;
+            }
+            const size_t carriageReturnPos = lineEnd - capture;
+            nmeaLine.set(capture + lineStart, carriageReturnPos - lineStart, lineXOR);
+            const bool valid = !nmeaLine.isEmpty() && nmeaLine.sanityCheck();
+            const uint64_t parseStart = nowNanoseconds();
+            NMEAMessage *message = valid ? parseNMEAMessage(nmeaLine) : NULL;
+            const uint64_t logStart = nowNanoseconds();
+            if (message != NULL && LOG_ENABLED(logDebugNMEA)) {
+                message->log();
+            }
+            const uint64_t bridgeStart = nowNanoseconds();
+            if (message != NULL) {
+                nmeaDataModelBridge.processMessage(message);
+            }
+            const uint64_t publishStart = nowNanoseconds();
+            mqttBroker.service();
+            const uint64_t publishEnd = nowNanoseconds();
+
+            frameNanoseconds += parseStart - frameStart;
+            parseNanoseconds += logStart - parseStart;
+            logNanoseconds += bridgeStart - logStart;
+            bridgeNanoseconds += publishStart - bridgeStart;
+            publishNanoseconds += publishEnd - publishStart;
+            lines++;
+
+            subscriber.drain();
+
+            lineStart = carriageReturnPos + 1;
+            if (lineStart < captureLength && capture[lineStart] == '\n') {
+                lineStart++;
+            }
+        }
+    }
+
+    printf("Per stage (%llu lines):\n", (unsigned long long)lines);
+    printf("  %12.1f ns/line frame and validate\n", (double)frameNanoseconds / lines);
+    printf("  %12.1f ns/line parse\n", (double)parseNanoseconds / lines);
+    printf("  %12.1f ns/line message log\n", (double)logNanoseconds / lines);
+    printf("  %12.1f ns/line bridge\n", (double)bridgeNanoseconds / lines);
+    printf("  %12.1f ns/line publish\n", (double)publishNanoseconds / lines);
+}
+
+int main(int argc, char **argv) {
+    const char *captureFile = argc > 1 ? argv[1] : defaultCaptureFile;
+    const unsigned passes = argc > 2 ? (unsigned)atoi(argv[2]) : defaultPasses;
+
+    Serial.disableInput();
+    logger.setLevel(LOGGER_LEVEL_ERROR);
+
+    size_t captureLength;
+    char *capture = loadCapture(captureFile, captureLength);
+
+    BenchmarkSubscriber subscriber;
+    aisDecoder.addMessageHandler(aisTargetTable);
+    startBroker(subscriber);
+
+    benchmarkPipeline(capture, captureLength, passes, subscriber);
+    benchmarkDuplicateSources(capture, captureLength, passes, subscriber);
+    benchmarkAISTargets(passes, subscriber);
+    benchmarkStages(capture, captureLength, passes, subscriber);
+    logger.flush();
+
+    free(capture);
+
+    return 0;
+}
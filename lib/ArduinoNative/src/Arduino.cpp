@@ -0,0 +1,128 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Arduino.h"
+
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+NativeSerial Serial;
+
+static uint64_t monotonicMicros() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+// Like on the boards, time starts at zero when the program does.
+static const uint64_t startMicros = monotonicMicros();
+
+unsigned long millis() {
+    return (uint32_t)((monotonicMicros() - startMicros) / 1000);
+}
+
+unsigned long micros() {
+    return (uint32_t)(monotonicMicros() - startMicros);
+}
+
+void delay(unsigned long ms) {
+    usleep(ms * 1000);
+}
+
+bool isDigit(int character) {
+    return character >= '0' && character <= '9';
+}
+
+bool isUpperCase(int character) {
+    return character >= 'A' && character <= 'Z';
+}
+
+bool isHexadecimalDigit(int character) {
+    return isDigit(character) || (character >= 'A' && character <= 'F') ||
+           (character >= 'a' && character <= 'f');
+}
+
+NativeSerial::NativeSerial() : inputEnabled(true) {
+}
+
+void NativeSerial::begin(__attribute__((unused)) unsigned long baudRate) {
+    if (inputEnabled) {
+        fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+    }
+}
+
+void NativeSerial::disableInput() {
+    inputEnabled = false;
+}
+
+int NativeSerial::available() {
+    if (!inputEnabled) {
+        return 0;
+    }
+
+    int bytesAvailable;
+    if (ioctl(STDIN_FILENO, FIONREAD, &bytesAvailable) < 0) {
+        return 0;
+    }
+
+    return bytesAvailable;
+}
+
+int NativeSerial::read() {
+    if (!inputEnabled) {
+        return -1;
+    }
+
+    uint8_t character;
+    if (::read(STDIN_FILENO, &character, 1) != 1) {
+        return -1;
+    }
+
+    return character;
+}
+
+int NativeSerial::peek() {
+    // Nothing in LunaMon peeks at the console.
+    return -1;
+}
+
+size_t NativeSerial::write(uint8_t character) {
+    return fwrite(&character, 1, 1, stdout);
+}
+
+size_t NativeSerial::write(const uint8_t *buffer, size_t size) {
+    return fwrite(buffer, 1, size, stdout);
+}
+
+// stdout is buffered by the C library, so never holds up the caller for long.
+int NativeSerial::availableForWrite() {
+    return BUFSIZ;
+}
+
+void NativeSerial::flush() {
+    fflush(stdout);
+}
+
+NativeSerial::operator bool() const {
+    return true;
+}
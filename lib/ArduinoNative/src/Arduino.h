@@ -0,0 +1,78 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+//
+// Host (PlatformIO native) stand-in for the small part of the Arduino core that LunaMon uses.
+// This exists so that the NMEA->Data Model->MQTT path can be built, profiled and benchmarked on a
+// development machine. It is not meant to be a general purpose Arduino emulation.
+//
+
+#include "Print.h"
+#include "Stream.h"
+#include "IPAddress.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+bool isDigit(int character);
+bool isUpperCase(int character);
+bool isHexadecimalDigit(int character);
+
+// Mirrors the ArduinoCore-API definitions, which allow mixed argument types.
+template<class T, class L>
+auto min(const T &a, const L &b) -> decltype((b < a) ? b : a) {
+    return (b < a) ? b : a;
+}
+
+template<class T, class L>
+auto max(const T &a, const L &b) -> decltype((b < a) ? b : a) {
+    return (a < b) ? b : a;
+}
+
+// The console. Output goes to stdout, input, if any, comes from stdin without blocking.
+class NativeSerial : public Stream {
+    private:
+        bool inputEnabled;
+
+    public:
+        NativeSerial();
+        void begin(unsigned long baudRate);
+        void disableInput();
+        virtual int available() override;
+        virtual int read() override;
+        virtual int peek() override;
+        virtual size_t write(uint8_t character) override;
+        virtual size_t write(const uint8_t *buffer, size_t size) override;
+        virtual int availableForWrite() override;
+        virtual void flush() override;
+        operator bool() const;
+};
+
+extern NativeSerial Serial;
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "IPAddress.h"
+
+#include <stdint.h>
+#include <string.h>
+
+namespace arduino {
+
+IPAddress::IPAddress() {
+    memset(octets, 0, sizeof(octets));
+}
+
+IPAddress::IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth) {
+    octets[0] = first;
+    octets[1] = second;
+    octets[2] = third;
+    octets[3] = fourth;
+}
+
+IPAddress::IPAddress(uint32_t networkOrderAddress) {
+    memcpy(octets, &networkOrderAddress, sizeof(octets));
+}
+
+bool IPAddress::fromString(const char *address) {
+    uint8_t newOctets[4];
+    unsigned octetIndex = 0;
+    unsigned value = 0;
+    bool digitSeen = false;
+
+    for (const char *pos = address; ; pos++) {
+        if (*pos >= '0' && *pos <= '9') {
+            value = value * 10 + (*pos - '0');
+            if (value > 255) {
+                return false;
+            }
+            digitSeen = true;
+        } else if (*pos == '.' || *pos == 0) {
+            if (!digitSeen || octetIndex == 4) {
+                return false;
+            }
+            newOctets[octetIndex++] = value;
+            value = 0;
+            digitSeen = false;
+            if (*pos == 0) {
+                break;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    if (octetIndex != 4) {
+        return false;
+    }
+
+    memcpy(octets, newOctets, sizeof(octets));
+    return true;
+}
+
+uint32_t IPAddress::networkOrderAddress() const {
+    uint32_t address;
+    memcpy(&address, octets, sizeof(address));
+    return address;
+}
+
+uint8_t IPAddress::operator [] (int index) const {
+    return octets[index];
+}
+
+uint8_t & IPAddress::operator [] (int index) {
+    return octets[index];
+}
+
+bool IPAddress::operator == (const IPAddress &other) const {
+    return memcmp(octets, other.octets, sizeof(octets)) == 0;
+}
+
+bool IPAddress::operator != (const IPAddress &other) const {
+    return !(*this == other);
+}
+
+}
@@ -16,34 +16,33 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef NMEA_TENTHS_INT16_H
-#define NMEA_TENTHS_INT16_H
-
-#include "NMEALine.h"
-#include "NMEATalker.h"
-
-#include "DataModel/DataModelTenthsInt16Leaf.h"
-
-#include "Util/LoggableItem.h"
-#include "Util/Logger.h"
-
-#include <etl/string_view.h>
-
+#ifndef IP_ADDRESS_H
+#define IP_ADDRESS_H
+#include <stdint.h>
+#include <stddef.h>
 #include <stdint.h>
 
-class NMEATenthsInt16 : public LoggableItem {
-    private:
-        int16_t integer;
-        uint8_t tenths;
-        bool valuePresent;
+namespace arduino {
 
-        bool set(const etl::string_view &valueView, bool optional);
+class IPAddress {
+    private:
+        uint8_t octets[4];
 
     public:
-        bool extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType,
-                     const char *fieldName, bool optional = false);
-        void publish(DataModelTenthsInt16Leaf &leaf) const;
-        virtual void log(Logger &logger) const override;
+        IPAddress();
+        IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth);
+        // In network byte order, as found in a struct in_addr.
+        explicit IPAddress(uint32_t networkOrderAddress);
+        bool fromString(const char *address);
+        uint32_t networkOrderAddress() const;
+        uint8_t operator [] (int index) const;
+        uint8_t & operator [] (int index);
+        bool operator == (const IPAddress &other) const;
+        bool operator != (const IPAddress &other) const;
 };
 
+}
+
+using arduino::IPAddress;
+
 #endif
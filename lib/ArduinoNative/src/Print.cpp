@@ -0,0 +1,76 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Print.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+    size_t written = 0;
+    while (size--) {
+        if (write(*buffer++) != 1) {
+            break;
+        }
+        written++;
+    }
+
+    return written;
+}
+
+size_t Print::write(const char *string) {
+    return write((const uint8_t *)string, strlen(string));
+}
+
+// As with Arduino, outputs that don't know how much they can take without blocking say nothing.
+int Print::availableForWrite() {
+    return 0;
+}
+
+void Print::flush() {
+}
+
+size_t Print::print(const char *string) {
+    return write(string);
+}
+
+size_t Print::print(char character) {
+    return write((uint8_t)character);
+}
+
+size_t Print::print(unsigned long value) {
+    char valueStr[21];
+    snprintf(valueStr, sizeof(valueStr), "%lu", value);
+    return write(valueStr);
+}
+
+size_t Print::print(long value) {
+    char valueStr[21];
+    snprintf(valueStr, sizeof(valueStr), "%ld", value);
+    return write(valueStr);
+}
+
+size_t Print::println() {
+    return write("\r\n");
+}
+
+size_t Print::println(const char *string) {
+    return print(string) + println();
+}
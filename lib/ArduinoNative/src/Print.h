@@ -16,34 +16,25 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef NMEA_UINT8_H
-#define NMEA_UINT8_H
-
-#include "NMEALine.h"
-#include "NMEATalker.h"
-
-#include "DataModel/DataModelUInt8Leaf.h"
-
-#include "Util/LoggableItem.h"
-#include "Util/Logger.h"
-
-#include <etl/string_view.h>
+#ifndef PRINT_H
+#define PRINT_H
 
 #include <stdint.h>
+#include <stddef.h>
 
-class NMEAUInt8 : public LoggableItem {
-    private:
-        uint8_t value;
-        bool valuePresent;
-
-        bool set(const etl::string_view &valueView, bool optional, uint8_t maxValue);
-
+class Print {
     public:
-        bool extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType,
-                     const char *fieldName, bool optional = false, uint8_t maxValue = 0xff);
-        bool hasValue() const;
-        void publish(DataModelUInt8Leaf &leaf) const;
-        virtual void log(Logger &logger) const override;
+        virtual size_t write(uint8_t character) = 0;
+        virtual size_t write(const uint8_t *buffer, size_t size);
+        size_t write(const char *string);
+        virtual int availableForWrite();
+        virtual void flush();
+        size_t print(const char *string);
+        size_t print(char character);
+        size_t print(unsigned long value);
+        size_t print(long value);
+        size_t println();
+        size_t println(const char *string);
 };
 
 #endif
@@ -0,0 +1,39 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Stream.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+size_t Stream::readBytes(char *buffer, size_t length) {
+    size_t count;
+    for (count = 0; count < length; count++) {
+        const int character = read();
+        if (character < 0) {
+            break;
+        }
+        buffer[count] = (char)character;
+    }
+
+    return count;
+}
+
+size_t Stream::readBytes(uint8_t *buffer, size_t length) {
+    return readBytes((char *)buffer, length);
+}
@@ -16,31 +16,22 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef NMEA_HUNDREDTHS_UINT16_H
-#define NMEA_HUNDREDTHS_UINT16_H
+#ifndef STREAM_H
+#define STREAM_H
 
-#include "NMEALine.h"
-#include "NMEATalker.h"
+#include "Print.h"
 
-#include "DataModel/DataModelHundredthsUInt16Leaf.h"
-
-#include "Util/LoggableItem.h"
-#include "Util/Logger.h"
-
-#include <etl/string_view.h>
-
-class NMEAHundredthsUInt16 : public LoggableItem {
-    private:
-        uint16_t wholeNumber;
-        uint8_t hundredths;
-
-        bool set(const etl::string_view &valueView);
+#include <stddef.h>
 
+class Stream : public Print {
     public:
-        bool extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType,
-                     const char *fieldName);
-        void publish(DataModelHundredthsUInt16Leaf &leaf) const;
-        virtual void log(Logger &logger) const override;
+        virtual int available() = 0;
+        virtual int read() = 0;
+        virtual int peek() = 0;
+        // Unlike the Arduino version, this doesn't wait around for more data to show up, it
+        // returns what was available.
+        virtual size_t readBytes(char *buffer, size_t length);
+        size_t readBytes(uint8_t *buffer, size_t length);
 };
 
 #endif
@@ -0,0 +1,200 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WiFiClient.h"
+
+#include "IPAddress.h"
+
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+WiFiClient::WiFiClient() : socketFD(-1) {
+}
+
+WiFiClient::WiFiClient(int socketFD) : socketFD(socketFD) {
+}
+
+int WiFiClient::connect(IPAddress ipAddress, uint16_t port) {
+    stop();
+
+    socketFD = socket(AF_INET, SOCK_STREAM, 0);
+    if (socketFD < 0) {
+        return 0;
+    }
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = ipAddress.networkOrderAddress();
+    if (::connect(socketFD, (struct sockaddr *)&address, sizeof(address)) < 0) {
+        stop();
+        return 0;
+    }
+
+    const int noDelay = 1;
+    setsockopt(socketFD, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    return 1;
+}
+
+uint8_t WiFiClient::connected() {
+    if (socketFD < 0) {
+        return 0;
+    }
+
+    // As with the NINA firmware, noticing that the other side has closed tears down our side.
+    uint8_t character;
+    const ssize_t result = recv(socketFD, &character, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (result == 0 || (result < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        stop();
+        return 0;
+    }
+
+    return 1;
+}
+
+int WiFiClient::available() {
+    if (socketFD < 0) {
+        return 0;
+    }
+
+    int bytesAvailable;
+    if (ioctl(socketFD, FIONREAD, &bytesAvailable) < 0) {
+        return 0;
+    }
+
+    return bytesAvailable;
+}
+
+int WiFiClient::read() {
+    uint8_t character;
+    if (read(&character, 1) != 1) {
+        return -1;
+    }
+
+    return character;
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size) {
+    if (socketFD < 0) {
+        return -1;
+    }
+
+    const ssize_t result = recv(socketFD, buffer, size, MSG_DONTWAIT);
+    if (result <= 0) {
+        return -1;
+    }
+
+    return (int)result;
+}
+
+int WiFiClient::peek() {
+    if (socketFD < 0) {
+        return -1;
+    }
+
+    uint8_t character;
+    if (recv(socketFD, &character, 1, MSG_PEEK | MSG_DONTWAIT) != 1) {
+        return -1;
+    }
+
+    return character;
+}
+
+size_t WiFiClient::readBytes(char *buffer, size_t length) {
+    const int result = read((uint8_t *)buffer, length);
+    if (result < 0) {
+        return 0;
+    }
+
+    return (size_t)result;
+}
+
+size_t WiFiClient::write(uint8_t character) {
+    return write(&character, 1);
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size) {
+    if (socketFD < 0) {
+        return 0;
+    }
+
+    size_t written = 0;
+    while (written < size) {
+        const ssize_t result = send(socketFD, buffer + written, size - written, MSG_NOSIGNAL);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        written += result;
+    }
+
+    return written;
+}
+
+void WiFiClient::flush() {
+}
+
+void WiFiClient::stop() {
+    if (socketFD >= 0) {
+        close(socketFD);
+        socketFD = -1;
+    }
+}
+
+IPAddress WiFiClient::remoteIP() {
+    struct sockaddr_in address;
+    socklen_t addressLength = sizeof(address);
+    if (socketFD < 0 ||
+        getpeername(socketFD, (struct sockaddr *)&address, &addressLength) < 0) {
+        return IPAddress();
+    }
+
+    return IPAddress((uint32_t)address.sin_addr.s_addr);
+}
+
+uint16_t WiFiClient::remotePort() {
+    struct sockaddr_in address;
+    socklen_t addressLength = sizeof(address);
+    if (socketFD < 0 ||
+        getpeername(socketFD, (struct sockaddr *)&address, &addressLength) < 0) {
+        return 0;
+    }
+
+    return ntohs(address.sin_port);
+}
+
+WiFiClient::operator bool() const {
+    return socketFD >= 0;
+}
+
+bool WiFiClient::operator == (const WiFiClient &other) const {
+    return socketFD == other.socketFD;
+}
@@ -0,0 +1,54 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WIFI_CLIENT_H
+#define WIFI_CLIENT_H
+
+#include "Stream.h"
+#include "IPAddress.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Like the WiFiNINA version, a WiFiClient is just a handle on a socket; copies refer to the same
+// connection and stopping any of them closes it.
+class WiFiClient : public Stream {
+    private:
+        int socketFD;
+
+    public:
+        WiFiClient();
+        explicit WiFiClient(int socketFD);
+        int connect(IPAddress ipAddress, uint16_t port);
+        uint8_t connected();
+        virtual int available() override;
+        virtual int read() override;
+        int read(uint8_t *buffer, size_t size);
+        virtual int peek() override;
+        virtual size_t readBytes(char *buffer, size_t length) override;
+        virtual size_t write(uint8_t character) override;
+        virtual size_t write(const uint8_t *buffer, size_t size) override;
+        virtual void flush() override;
+        void stop();
+        IPAddress remoteIP();
+        uint16_t remotePort();
+        operator bool() const;
+        bool operator == (const WiFiClient &other) const;
+};
+
+#endif
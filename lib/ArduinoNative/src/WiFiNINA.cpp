@@ -0,0 +1,45 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WiFiNINA.h"
+
+#include "IPAddress.h"
+
+#include <stdint.h>
+
+WiFiClass WiFi;
+
+uint8_t WiFiClass::status() {
+    return WL_CONNECTED;
+}
+
+uint8_t WiFiClass::begin(__attribute__((unused)) const char *ssid,
+                         __attribute__((unused)) const char *passphrase) {
+    return WL_CONNECTED;
+}
+
+const char *WiFiClass::firmwareVersion() {
+    return "1.5.0";
+}
+
+void WiFiClass::setTimeout(__attribute__((unused)) unsigned long timeout) {
+}
+
+IPAddress WiFiClass::localIP() {
+    return IPAddress(127, 0, 0, 1);
+}
@@ -0,0 +1,56 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WIFI_NINA_H
+#define WIFI_NINA_H
+
+//
+// Host stand-in for the WiFiNINA library. The "network" is always up and WiFiClient and WiFiServer
+// are backed by ordinary sockets, with servers only listening on the loopback interface.
+//
+
+#include "WiFiClient.h"
+#include "WiFiServer.h"
+#include "IPAddress.h"
+
+#include <stdint.h>
+
+enum wl_status_t {
+    WL_NO_SHIELD = 255,
+    WL_NO_MODULE = WL_NO_SHIELD,
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED
+};
+
+class WiFiClass {
+    public:
+        uint8_t status();
+        uint8_t begin(const char *ssid, const char *passphrase);
+        const char *firmwareVersion();
+        void setTimeout(unsigned long timeout);
+        IPAddress localIP();
+};
+
+extern WiFiClass WiFi;
+
+#endif
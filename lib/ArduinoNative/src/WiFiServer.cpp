@@ -0,0 +1,80 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WiFiServer.h"
+#include "WiFiClient.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+WiFiServer::WiFiServer(uint16_t port) : port(port), listenFD(-1) {
+}
+
+void WiFiServer::begin() {
+    listenFD = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFD < 0) {
+        perror("WiFiServer socket");
+        exit(1);
+    }
+
+    const int reuseAddress = 1;
+    setsockopt(listenFD, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(listenFD, (struct sockaddr *)&address, sizeof(address)) < 0) {
+        fprintf(stderr, "WiFiServer unable to bind to loopback port %u: ", port);
+        perror(NULL);
+        exit(1);
+    }
+
+    if (listen(listenFD, 5) < 0) {
+        perror("WiFiServer listen");
+        exit(1);
+    }
+
+    fcntl(listenFD, F_SETFL, fcntl(listenFD, F_GETFL) | O_NONBLOCK);
+}
+
+WiFiClient WiFiServer::available() {
+    if (listenFD < 0) {
+        return WiFiClient();
+    }
+
+    const int socketFD = accept(listenFD, NULL, NULL);
+    if (socketFD < 0) {
+        return WiFiClient();
+    }
+
+    const int noDelay = 1;
+    setsockopt(socketFD, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    return WiFiClient(socketFD);
+}
@@ -16,33 +16,24 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef NMEA_HUNDREDTHS_UINT8_H
-#define NMEA_HUNDREDTHS_UINT8_H
+#ifndef WIFI_SERVER_H
+#define WIFI_SERVER_H
 
-#include "NMEALine.h"
-#include "NMEATalker.h"
-
-#include "DataModel/DataModelHundredthsUInt8Leaf.h"
-
-#include "Util/LoggableItem.h"
-#include "Util/Logger.h"
-
-#include <etl/string_view.h>
+#include "WiFiClient.h"
 
 #include <stdint.h>
 
-class NMEAHundredthsUInt8 : public LoggableItem {
+class WiFiServer {
     private:
-        uint8_t wholeNumber;
-        uint8_t hundredths;
-
-        bool set(const etl::string_view &decimalString);
+        uint16_t port;
+        int listenFD;
 
     public:
-        bool extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType,
-                     const char *fieldName);
-        void publish(DataModelHundredthsUInt8Leaf &leaf) const;
-        virtual void log(Logger &logger) const override;
+        WiFiServer(uint16_t port);
+        void begin();
+        // Returns a newly accepted connection, if there is one. Unlike the NINA firmware, this
+        // never hands back an existing connection that happens to have data.
+        WiFiClient available();
 };
 
 #endif
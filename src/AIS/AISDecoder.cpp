@@ -0,0 +1,276 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AISDecoder.h"
+#include "AISMessage.h"
+#include "AISMessageHandler.h"
+#include "AISPayload.h"
+#include "AISFragmentPool.h"
+
+#include "NMEA/NMEAMessage.h"
+#include "NMEA/NMEAMsgType.h"
+#include "NMEA/NMEAVDMVDOMessage.h"
+
+#include "DataModel/DataModel.h"
+
+#include "StatsManager/StatsManager.h"
+
+#include "Util/Logger.h"
+#include "Util/Error.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Minimum lengths, in bits, of the decoded message types. Some transmitters send type 5 messages
+// two bits short, which only costs the spare bit at the end.
+static const size_t positionReportBits = 168;
+static const size_t staticAndVoyageDataBits = 422;
+static const size_t classBPositionReportBits = 168;
+static const size_t classBExtendedPositionReportBits = 312;
+static const size_t staticDataReportPartABits = 160;
+static const size_t staticDataReportPartBBits = 162;
+
+AISDecoder::AISDecoder(StatsManager &statsManager)
+    : messageHandlers(), messagesCounter(), unsupportedMessages(0), badMessages(0) {
+    statsManager.addStatsHolder(this);
+}
+
+void AISDecoder::addMessageHandler(AISMessageHandler &messageHandler) {
+    if (messageHandlers.full()) {
+        fatalError("Too many message handlers for AIS decoder");
+    }
+
+    messageHandlers.push_back(&messageHandler);
+}
+
+void AISDecoder::processMessage(NMEAMessage *message) {
+    const NMEAMsgType msgType = message->type();
+    if (msgType != NMEA_MSG_TYPE_VDM && msgType != NMEA_MSG_TYPE_VDO) {
+        return;
+    }
+    NMEAVDMVDOMessage *vdmVDOMessage = (NMEAVDMVDOMessage *)message;
+
+    if (!vdmVDOMessage->totalFragments.hasValue() || !vdmVDOMessage->fragmentNumber.hasValue() ||
+        !vdmVDOMessage->fillBits.hasValue()) {
+        badMessages++;
+        return;
+    }
+    const uint8_t totalFragments = vdmVDOMessage->totalFragments.getValue();
+    const uint8_t fragmentNumber = vdmVDOMessage->fragmentNumber.getValue();
+    const uint8_t fillBits = vdmVDOMessage->fillBits.getValue();
+
+    // Single sentence messages, by far the most common, are decoded in place in the line.
+    AISPayload payload;
+    if (totalFragments == 1) {
+        if (!payload.set(vdmVDOMessage->payload, fillBits)) {
+            LOG(logWarning) << "Bad AIS payload in " << nmeaMsgTypeName(msgType) << eol;
+            badMessages++;
+            return;
+        }
+    } else {
+        // Multi-sentence messages without a sequential id can still be reassembled as long as
+        // they aren't interleaved with others.
+        const uint8_t sequentialId = vdmVDOMessage->messageId.hasValue()
+                                         ? (uint8_t)vdmVDOMessage->messageId.getValue() : 0xff;
+        if (!fragmentPool.addFragment(vdmVDOMessage->payload, fragmentNumber, totalFragments,
+                                      sequentialId, vdmVDOMessage->radioChannelCode.channel(),
+                                      fillBits, payload)) {
+            return;
+        }
+    }
+
+    aisMessage.ownShip = vdmVDOMessage->isOwnShip();
+    if (!decode(payload)) {
+        return;
+    }
+
+    LOG(logDebugAIS) << aisMessage << eol;
+
+    for (AISMessageHandler *messageHandler : messageHandlers) {
+        messageHandler->processAISMessage(aisMessage);
+    }
+
+    messagesCounter++;
+}
+
+bool AISDecoder::decode(const AISPayload &payload) {
+    aisMessage.messageType = payload.unsignedField(0, 6);
+    aisMessage.repeatIndicator = payload.unsignedField(6, 2);
+    aisMessage.mmsi = payload.unsignedField(8, 30);
+    aisMessage.contents = 0;
+
+    bool decoded;
+    switch (aisMessage.messageType) {
+        case 1:
+        case 2:
+        case 3:
+            decoded = decodePositionReport(payload);
+            break;
+
+        case 5:
+            decoded = decodeStaticAndVoyageData(payload);
+            break;
+
+        case 18:
+            decoded = decodeClassBPositionReport(payload);
+            break;
+
+        case 19:
+            decoded = decodeClassBExtendedPositionReport(payload);
+            break;
+
+        case 24:
+            decoded = decodeStaticDataReport(payload);
+            break;
+
+        default:
+            unsupportedMessages++;
+            return false;
+    }
+
+    if (!decoded) {
+        LOG(logWarning) << "Bad AIS type " << aisMessage.messageType << " message of "
+                        << (uint16_t)payload.bits() << " bits" << eol;
+        badMessages++;
+    }
+
+    return decoded;
+}
+
+bool AISDecoder::decodePositionReport(const AISPayload &payload) {
+    if (payload.bits() < positionReportBits) {
+        return false;
+    }
+
+    aisMessage.navigationStatus = payload.unsignedField(38, 4);
+    aisMessage.rateOfTurn = payload.signedField(42, 8);
+    aisMessage.speedOverGround = payload.unsignedField(50, 10);
+    aisMessage.positionAccurate = payload.boolField(60);
+    aisMessage.longitude = payload.signedField(61, 28);
+    aisMessage.latitude = payload.signedField(89, 27);
+    aisMessage.courseOverGround = payload.unsignedField(116, 12);
+    aisMessage.trueHeading = payload.unsignedField(128, 9);
+    aisMessage.timestampSecond = payload.unsignedField(137, 6);
+    aisMessage.contents = AIS_CONTENTS_POSITION;
+
+    return true;
+}
+
+bool AISDecoder::decodeStaticAndVoyageData(const AISPayload &payload) {
+    if (payload.bits() < staticAndVoyageDataBits) {
+        return false;
+    }
+
+    aisMessage.imoNumber = payload.unsignedField(40, 30);
+    payload.textField(70, 7, aisMessage.callSign);
+    payload.textField(112, 20, aisMessage.name);
+    aisMessage.shipType = payload.unsignedField(232, 8);
+    decodeDimensions(payload, 240);
+    aisMessage.etaMonth = payload.unsignedField(274, 4);
+    aisMessage.etaDay = payload.unsignedField(278, 5);
+    aisMessage.etaHour = payload.unsignedField(283, 5);
+    aisMessage.etaMinute = payload.unsignedField(288, 6);
+    aisMessage.draught = payload.unsignedField(294, 8);
+    payload.textField(302, 20, aisMessage.destination);
+    aisMessage.contents = AIS_CONTENTS_NAME | AIS_CONTENTS_CALL_SIGN | AIS_CONTENTS_SHIP_TYPE |
+                          AIS_CONTENTS_DIMENSIONS | AIS_CONTENTS_VOYAGE;
+
+    return true;
+}
+
+// Types 18 and 19 share the layout of their position fields, and neither has a navigation status
+// or rate of turn.
+void AISDecoder::decodeClassBPosition(const AISPayload &payload) {
+    aisMessage.navigationStatus = aisNavigationStatusNotDefined;
+    aisMessage.rateOfTurn = aisRateOfTurnNotAvailable;
+    aisMessage.speedOverGround = payload.unsignedField(46, 10);
+    aisMessage.positionAccurate = payload.boolField(56);
+    aisMessage.longitude = payload.signedField(57, 28);
+    aisMessage.latitude = payload.signedField(85, 27);
+    aisMessage.courseOverGround = payload.unsignedField(112, 12);
+    aisMessage.trueHeading = payload.unsignedField(124, 9);
+    aisMessage.timestampSecond = payload.unsignedField(133, 6);
+}
+
+bool AISDecoder::decodeClassBPositionReport(const AISPayload &payload) {
+    if (payload.bits() < classBPositionReportBits) {
+        return false;
+    }
+
+    decodeClassBPosition(payload);
+    aisMessage.contents = AIS_CONTENTS_POSITION;
+
+    return true;
+}
+
+bool AISDecoder::decodeClassBExtendedPositionReport(const AISPayload &payload) {
+    if (payload.bits() < classBExtendedPositionReportBits) {
+        return false;
+    }
+
+    decodeClassBPosition(payload);
+    payload.textField(143, 20, aisMessage.name);
+    aisMessage.shipType = payload.unsignedField(263, 8);
+    decodeDimensions(payload, 271);
+    aisMessage.contents = AIS_CONTENTS_POSITION | AIS_CONTENTS_NAME | AIS_CONTENTS_SHIP_TYPE |
+                          AIS_CONTENTS_DIMENSIONS;
+
+    return true;
+}
+
+// Type 24 comes in two parts, A with the name and B with the rest of the static data.
+bool AISDecoder::decodeStaticDataReport(const AISPayload &payload) {
+    const uint8_t partNumber = payload.unsignedField(38, 2);
+    switch (partNumber) {
+        case 0:
+            if (payload.bits() < staticDataReportPartABits) {
+                return false;
+            }
+            payload.textField(40, 20, aisMessage.name);
+            aisMessage.contents = AIS_CONTENTS_NAME;
+            return true;
+
+        case 1:
+            if (payload.bits() < staticDataReportPartBBits) {
+                return false;
+            }
+            aisMessage.shipType = payload.unsignedField(40, 8);
+            payload.textField(90, 7, aisMessage.callSign);
+            decodeDimensions(payload, 132);
+            aisMessage.contents = AIS_CONTENTS_SHIP_TYPE | AIS_CONTENTS_CALL_SIGN |
+                                  AIS_CONTENTS_DIMENSIONS;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+void AISDecoder::decodeDimensions(const AISPayload &payload, size_t startBit) {
+    aisMessage.dimensionToBow = payload.unsignedField(startBit, 9);
+    aisMessage.dimensionToStern = payload.unsignedField(startBit + 9, 9);
+    aisMessage.dimensionToPort = payload.unsignedField(startBit + 18, 6);
+    aisMessage.dimensionToStarboard = payload.unsignedField(startBit + 24, 6);
+}
+
+void AISDecoder::exportStats(uint32_t msElapsed) {
+    messagesCounter.update(sysAISMessages, sysAISMessageRate, msElapsed);
+    sysAISUnsupported << unsupportedMessages;
+    sysAISBadMessages << badMessages;
+    sysAISFragmentsDropped << fragmentPool.dropped();
+}
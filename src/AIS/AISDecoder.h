@@ -0,0 +1,70 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AIS_DECODER_H
+#define AIS_DECODER_H
+
+class AISMessageHandler;
+class NMEAVDMVDOMessage;
+class StatsManager;
+
+#include "AISMessage.h"
+#include "AISPayload.h"
+#include "AISFragmentPool.h"
+
+#include "NMEA/NMEAMessageHandler.h"
+
+#include "StatsManager/StatCounter.h"
+#include "StatsManager/StatsHolder.h"
+
+#include <etl/vector.h>
+
+#include <stdint.h>
+
+// Decodes the AIS payloads carried in VDM and VDO sentences, reassembling multi-sentence messages,
+// and hands the decoded messages to its handlers. Message types 1, 2 and 3 (Class A position
+// reports), 5 (Class A static and voyage data), 18 and 19 (Class B position reports) and 24
+// (Class B static data) are decoded, other types are counted and skipped.
+class AISDecoder : public NMEAMessageHandler, public StatsHolder {
+    private:
+        static const size_t maxMessageHandlers = 3;
+
+        AISFragmentPool fragmentPool;
+        AISMessage aisMessage;
+        etl::vector<AISMessageHandler *, maxMessageHandlers> messageHandlers;
+        StatCounter messagesCounter;
+        uint32_t unsupportedMessages;
+        uint32_t badMessages;
+
+        bool decode(const AISPayload &payload);
+        bool decodePositionReport(const AISPayload &payload);
+        bool decodeStaticAndVoyageData(const AISPayload &payload);
+        bool decodeClassBPositionReport(const AISPayload &payload);
+        bool decodeClassBExtendedPositionReport(const AISPayload &payload);
+        bool decodeStaticDataReport(const AISPayload &payload);
+        void decodeClassBPosition(const AISPayload &payload);
+        void decodeDimensions(const AISPayload &payload, size_t startBit);
+
+    public:
+        AISDecoder(StatsManager &statsManager);
+        void addMessageHandler(AISMessageHandler &messageHandler);
+        virtual void processMessage(NMEAMessage *message) override;
+        virtual void exportStats(uint32_t msElapsed) override;
+};
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AISFragmentPool.h"
+#include "AISPayload.h"
+
+#include "Util/Logger.h"
+
+#include <etl/string_view.h>
+
+#include <Arduino.h>
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+AISFragmentPool::AISFragmentPool() : droppedMessages(0) {
+    for (Slot &slot : slots) {
+        slot.inUse = false;
+    }
+}
+
+AISFragmentPool::Slot *AISFragmentPool::findSlot(uint8_t sequentialId, char channel) {
+    for (Slot &slot : slots) {
+        if (slot.inUse && slot.sequentialId == sequentialId && slot.channel == channel) {
+            return &slot;
+        }
+    }
+
+    return NULL;
+}
+
+// Finds a slot for a new message, reclaiming timed out slots and, failing that, the oldest one.
+AISFragmentPool::Slot *AISFragmentPool::allocateSlot(uint32_t now) {
+    Slot *oldestSlot = NULL;
+    for (Slot &slot : slots) {
+        if (!slot.inUse) {
+            return &slot;
+        }
+        if (now - slot.startMs >= fragmentTimeoutMs) {
+            droppedMessages++;
+            slot.inUse = false;
+            return &slot;
+        }
+        if (oldestSlot == NULL || now - slot.startMs > now - oldestSlot->startMs) {
+            oldestSlot = &slot;
+        }
+    }
+
+    droppedMessages++;
+    return oldestSlot;
+}
+
+// Adds a fragment, returning true, with the payload set, if it completed a message. The completed
+// payload refers to the pool's copy of the message and is only good until the next fragment is
+// added.
+bool AISFragmentPool::addFragment(const etl::string_view &armoredView, uint8_t fragmentNumber,
+                                  uint8_t totalFragments, uint8_t sequentialId, char channel,
+                                  uint8_t fillBits, AISPayload &payload) {
+    const uint32_t now = millis();
+    Slot *slot = findSlot(sequentialId, channel);
+
+    if (fragmentNumber == 1) {
+        if (slot != NULL) {
+            // The sequential id has come back around before the last message using it finished.
+            droppedMessages++;
+        } else {
+            slot = allocateSlot(now);
+        }
+        slot->inUse = true;
+        slot->sequentialId = sequentialId;
+        slot->channel = channel;
+        slot->totalFragments = totalFragments;
+        slot->nextFragment = 1;
+        slot->payloadLength = 0;
+        slot->startMs = now;
+    } else if (slot == NULL || slot->nextFragment != fragmentNumber ||
+               slot->totalFragments != totalFragments) {
+        LOG(logDebugAIS) << "Out of sequence AIS fragment " << fragmentNumber << " of "
+                         << totalFragments << " for message " << sequentialId << eol;
+        if (slot != NULL) {
+            slot->inUse = false;
+            droppedMessages++;
+        }
+        return false;
+    }
+
+    if (slot->payloadLength + armoredView.size() > maxPayloadLength) {
+        LOG(logWarning) << "AIS message too long to reassemble" << eol;
+        slot->inUse = false;
+        droppedMessages++;
+        return false;
+    }
+    memcpy(slot->payload + slot->payloadLength, armoredView.data(), armoredView.size());
+    slot->payloadLength += armoredView.size();
+
+    if (fragmentNumber < totalFragments) {
+        slot->nextFragment++;
+        return false;
+    }
+
+    slot->inUse = false;
+    if (!payload.set(etl::string_view(slot->payload, slot->payloadLength), fillBits)) {
+        LOG(logWarning) << "Bad AIS payload" << eol;
+        return false;
+    }
+
+    return true;
+}
+
+uint32_t AISFragmentPool::dropped() const {
+    return droppedMessages;
+}
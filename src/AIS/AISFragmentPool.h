@@ -0,0 +1,66 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AIS_FRAGMENT_POOL_H
+#define AIS_FRAGMENT_POOL_H
+
+#include "AISPayload.h"
+
+#include <etl/string_view.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Reassembles AIS messages that are split over more than one VDM/VDO sentence. Partial messages
+// are held in a small fixed pool of slots, keyed on the sentences' sequential message id and
+// radio channel, rather than being allocated. Fragments must arrive in order, and a partial
+// message that doesn't complete within the timeout, or that gets pushed out by a newer one when
+// the pool is full, is dropped.
+class AISFragmentPool {
+    private:
+        // Enough for a type 5 message, the longest of the ones decoded, with room to spare.
+        static const size_t maxPayloadLength = 96;
+        static const size_t poolSlots = 4;
+        static const uint32_t fragmentTimeoutMs = 2000;
+
+        struct Slot {
+            bool inUse;
+            uint8_t sequentialId;
+            char channel;
+            uint8_t totalFragments;
+            uint8_t nextFragment;
+            uint8_t payloadLength;
+            uint32_t startMs;
+            char payload[maxPayloadLength];
+        };
+
+        Slot slots[poolSlots];
+        uint32_t droppedMessages;
+
+        Slot *findSlot(uint8_t sequentialId, char channel);
+        Slot *allocateSlot(uint32_t now);
+
+    public:
+        AISFragmentPool();
+        bool addFragment(const etl::string_view &armoredView, uint8_t fragmentNumber,
+                         uint8_t totalFragments, uint8_t sequentialId, char channel,
+                         uint8_t fillBits, AISPayload &payload);
+        uint32_t dropped() const;
+};
+
+#endif
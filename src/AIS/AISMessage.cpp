@@ -0,0 +1,59 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AISMessage.h"
+
+#include "Util/Logger.h"
+
+#include <stdint.h>
+
+AISMessage::AISMessage()
+    : messageType(0), repeatIndicator(0), mmsi(0), contents(0), ownShip(false) {
+}
+
+bool AISMessage::has(AISContents contentsGroup) const {
+    return (contents & contentsGroup) != 0;
+}
+
+void AISMessage::log(Logger &logger) const {
+    logger << "Type " << messageType << " MMSI " << mmsi;
+    if (ownShip) {
+        logger << " (own ship)";
+    }
+
+    if (has(AIS_CONTENTS_POSITION)) {
+        logger << " Lat " << (int)latitude << " Lon " << (int)longitude << " SOG "
+               << speedOverGround << " COG " << courseOverGround << " HDG " << trueHeading;
+    }
+    if (has(AIS_CONTENTS_NAME)) {
+        logger << " Name '" << name << "'";
+    }
+    if (has(AIS_CONTENTS_CALL_SIGN)) {
+        logger << " Call Sign '" << callSign << "'";
+    }
+    if (has(AIS_CONTENTS_SHIP_TYPE)) {
+        logger << " Ship Type " << shipType;
+    }
+    if (has(AIS_CONTENTS_DIMENSIONS)) {
+        logger << " Size " << (uint16_t)(dimensionToBow + dimensionToStern) << "x"
+               << (uint16_t)(dimensionToPort + dimensionToStarboard);
+    }
+    if (has(AIS_CONTENTS_VOYAGE)) {
+        logger << " Destination '" << destination << "'";
+    }
+}
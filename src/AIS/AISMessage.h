@@ -0,0 +1,110 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AIS_MESSAGE_H
+#define AIS_MESSAGE_H
+
+#include "Util/LoggableItem.h"
+
+#include <etl/string.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+class Logger;
+
+// Which groups of fields a decoded message carries. Position reports (types 1, 2, 3 and 18) only
+// carry a position, while static and voyage data comes in type 5 messages, and in pieces in
+// types 19 and 24.
+enum AISContents : uint8_t {
+    AIS_CONTENTS_POSITION = 0x01,
+    AIS_CONTENTS_NAME = 0x02,
+    AIS_CONTENTS_CALL_SIGN = 0x04,
+    AIS_CONTENTS_SHIP_TYPE = 0x08,
+    AIS_CONTENTS_DIMENSIONS = 0x10,
+    AIS_CONTENTS_VOYAGE = 0x20
+};
+
+const size_t aisNameLength = 20;
+const size_t aisCallSignLength = 7;
+const size_t aisDestinationLength = 20;
+
+// Field values AIS uses to say that a value isn't available. Positions are in 1/10000 minute.
+const int32_t aisLongitudeNotAvailable = 181 * 60 * 10000;
+const int32_t aisLatitudeNotAvailable = 91 * 60 * 10000;
+const uint16_t aisSpeedNotAvailable = 1023;
+const uint16_t aisCourseNotAvailable = 3600;
+const uint16_t aisHeadingNotAvailable = 511;
+const int8_t aisRateOfTurnNotAvailable = -128;
+const uint8_t aisNavigationStatusNotDefined = 15;
+
+// A decoded AIS message, holding the raw field values in the units used on the air. Only the
+// fields in the groups flagged in contents have been set.
+class AISMessage : public LoggableItem {
+    public:
+        uint8_t messageType;
+        uint8_t repeatIndicator;
+        uint32_t mmsi;
+        uint8_t contents;
+        bool ownShip;
+
+        // Position, AIS_CONTENTS_POSITION
+        uint8_t navigationStatus;
+        int8_t rateOfTurn;
+        // Tenths of a knot
+        uint16_t speedOverGround;
+        bool positionAccurate;
+        // 1/10000 minute, positive is East and North
+        int32_t longitude;
+        int32_t latitude;
+        // Tenths of a degree
+        uint16_t courseOverGround;
+        uint16_t trueHeading;
+        uint8_t timestampSecond;
+
+        // AIS_CONTENTS_NAME
+        etl::string<aisNameLength> name;
+
+        // AIS_CONTENTS_CALL_SIGN
+        etl::string<aisCallSignLength> callSign;
+
+        // AIS_CONTENTS_SHIP_TYPE
+        uint8_t shipType;
+
+        // AIS_CONTENTS_DIMENSIONS, in meters from the position reference point
+        uint16_t dimensionToBow;
+        uint16_t dimensionToStern;
+        uint8_t dimensionToPort;
+        uint8_t dimensionToStarboard;
+
+        // AIS_CONTENTS_VOYAGE
+        uint32_t imoNumber;
+        uint8_t etaMonth;
+        uint8_t etaDay;
+        uint8_t etaHour;
+        uint8_t etaMinute;
+        // Tenths of a meter
+        uint8_t draught;
+        etl::string<aisDestinationLength> destination;
+
+        AISMessage();
+        bool has(AISContents contentsGroup) const;
+        virtual void log(Logger &logger) const override;
+};
+
+#endif
@@ -1,6 +1,6 @@
 /*
  * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
- * Copyright (C) 2023 Lisa Rowell
+ * Copyright (C) 2021-2023 Lisa Rowell
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -16,30 +16,14 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef NMEA_DBS_MESSAGE_H
-#define NMEA_DBS_MESSAGE_H
+#ifndef AIS_MESSAGE_HANDLER_H
+#define AIS_MESSAGE_HANDLER_H
 
-#include "NMEAMessage.h"
-
-#include "NMEATenthsUInt16.h"
-#include "NMEATalker.h"
-#include "NMEALine.h"
-
-class NMEADBSMessage : public NMEAMessage {
-    private:
-        NMEATenthsUInt16 depthFeet;
-        NMEATenthsUInt16 depthMeters;
-        NMEATenthsUInt16 depthFathoms;
+#include "AISMessage.h"
 
+class AISMessageHandler {
     public:
-        NMEADBSMessage(NMEATalker &talker);
-        bool parse(NMEALine &nmeaLine);
-        virtual enum NMEAMsgType type() const override;
-        virtual void log() const override;
-
-    friend class NMEADataModelBridge;
+        virtual void processAISMessage(const AISMessage &message) = 0;
 };
 
-extern NMEADBSMessage *parseNMEADBSMessage(NMEATalker &talker, NMEALine &nmeaLine);
-
-#endif //NMEA_DBS_MESSAGE_H
+#endif
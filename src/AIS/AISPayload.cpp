@@ -0,0 +1,120 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AISPayload.h"
+
+#include <etl/string.h>
+#include <etl/string_view.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Maps armored payload characters to their six bit values. Legal characters are '0' through 'W'
+// and '`' through 'w', anything else maps to 0xff.
+static const uint8_t dearmorTable[128] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+// The six bit character set used for names, call signs and destinations in AIS messages.
+static const char sixBitASCII[64 + 1] =
+    "@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_ !\"#$%&'()*+,-./0123456789:;<=>?";
+
+AISPayload::AISPayload() : armoredChars(NULL), armoredLength(0), bitCount(0) {
+}
+
+// Validates the armored characters and the fill bit count, returning false if either is bad.
+bool AISPayload::set(const etl::string_view &armoredView, uint8_t fillBits) {
+    if (armoredView.empty() || fillBits > 5) {
+        return false;
+    }
+
+    for (char armoredChar : armoredView) {
+        if ((uint8_t)armoredChar >= 128 || dearmorTable[(uint8_t)armoredChar] == 0xff) {
+            return false;
+        }
+    }
+
+    armoredChars = armoredView.data();
+    armoredLength = armoredView.size();
+    bitCount = armoredLength * 6 - fillBits;
+
+    return true;
+}
+
+size_t AISPayload::bits() const {
+    return bitCount;
+}
+
+uint8_t AISPayload::sixBits(size_t charIndex) const {
+    return dearmorTable[(uint8_t)armoredChars[charIndex]];
+}
+
+// Returns the unsigned value of a field of up to 32 bits. Bits past the end of the payload read as
+// zero, which lets the shorter variants of some messages be decoded without special casing.
+uint32_t AISPayload::unsignedField(size_t startBit, size_t fieldBits) const {
+    size_t charIndex = startBit / 6;
+    const size_t skipBits = startBit % 6;
+    size_t accumulatedBits = 0;
+    uint64_t accumulator = 0;
+
+    while (accumulatedBits < skipBits + fieldBits) {
+        accumulator <<= 6;
+        if (charIndex < armoredLength) {
+            accumulator |= sixBits(charIndex);
+        }
+        charIndex++;
+        accumulatedBits += 6;
+    }
+
+    accumulator >>= accumulatedBits - skipBits - fieldBits;
+    return (uint32_t)(accumulator & ((1ULL << fieldBits) - 1));
+}
+
+int32_t AISPayload::signedField(size_t startBit, size_t fieldBits) const {
+    const uint32_t value = unsignedField(startBit, fieldBits);
+    const uint32_t signBit = (uint32_t)1 << (fieldBits - 1);
+
+    return (int32_t)((value ^ signBit) - signBit);
+}
+
+bool AISPayload::boolField(size_t startBit) const {
+    return unsignedField(startBit, 1) != 0;
+}
+
+// Reads a field of six bit characters, dropping the '@' padding and trailing spaces.
+void AISPayload::textField(size_t startBit, size_t textChars, etl::istring &text) const {
+    text.clear();
+    for (size_t textPos = 0; textPos < textChars && !text.full(); textPos++) {
+        const char character = sixBitASCII[unsignedField(startBit + textPos * 6, 6)];
+        if (character == '@') {
+            break;
+        }
+        text.push_back(character);
+    }
+
+    while (!text.empty() && text.back() == ' ') {
+        text.pop_back();
+    }
+}
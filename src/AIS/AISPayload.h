@@ -0,0 +1,51 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AIS_PAYLOAD_H
+#define AIS_PAYLOAD_H
+
+#include <etl/string.h>
+#include <etl/string_view.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// The armored, six bits per character, payload of an AIS message along with accessors for reading
+// its bit fields. The payload isn't copied or de-armored up front, characters are converted
+// through a lookup table as the fields that span them are read, so the characters must stay put
+// while the payload is in use. For a single fragment message they are read straight out of the
+// NMEA line.
+class AISPayload {
+    private:
+        const char *armoredChars;
+        size_t armoredLength;
+        size_t bitCount;
+
+        uint8_t sixBits(size_t charIndex) const;
+
+    public:
+        AISPayload();
+        bool set(const etl::string_view &armoredView, uint8_t fillBits);
+        size_t bits() const;
+        uint32_t unsignedField(size_t startBit, size_t fieldBits) const;
+        int32_t signedField(size_t startBit, size_t fieldBits) const;
+        bool boolField(size_t startBit) const;
+        void textField(size_t startBit, size_t textChars, etl::istring &text) const;
+};
+
+#endif
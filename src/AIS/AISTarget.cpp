@@ -0,0 +1,223 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AISTarget.h"
+#include "AISMessage.h"
+
+#include "NMEA/NMEACoordinate.h"
+
+#include "DataModel/DataModel.h"
+#include "DataModel/DataModelSlotNode.h"
+#include "DataModel/DataModelStringLeaf.h"
+#include "DataModel/DataModelTenthsUInt16Leaf.h"
+#include "DataModel/DataModelUInt16Leaf.h"
+
+#include <etl/string.h>
+#include <etl/to_string.h>
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+AISTarget::AISTarget()
+    : node(mmsiName, &aisNode, children),
+      latitudeLeaf("latitude", &node, latitudeBuffer),
+      longitudeLeaf("longitude", &node, longitudeBuffer),
+      speedOverGroundLeaf("speedOverGround", &node),
+      courseOverGroundLeaf("courseOverGround", &node),
+      headingLeaf("heading", &node),
+      nameLeaf("name", &node, nameBuffer),
+      mmsi(0), lastHeardMs(0), lastPublishedMs(0), changes(0), latitude(0), longitude(0),
+      speedOverGround(0), courseOverGround(0), trueHeading(0), name() {
+    mmsiName[0] = 0;
+
+    children[0] = &latitudeLeaf;
+    children[1] = &longitudeLeaf;
+    children[2] = &speedOverGroundLeaf;
+    children[3] = &courseOverGroundLeaf;
+    children[4] = &headingLeaf;
+    children[5] = &nameLeaf;
+    children[leafCount] = NULL;
+}
+
+DataModelElement *AISTarget::dataModelNode() {
+    return &node;
+}
+
+bool AISTarget::inUse() const {
+    return mmsi != 0;
+}
+
+uint32_t AISTarget::targetMMSI() const {
+    return mmsi;
+}
+
+uint32_t AISTarget::lastHeard() const {
+    return lastHeardMs;
+}
+
+// Takes the slot over for a new target. The slot's Data Model node keeps the old target's name,
+// and its values, until the slot is next published, so that a busy table churning through targets
+// is held to the same publish rate as one that isn't. Subscriptions made with wildcards carry over
+// to the new target, while ones naming the old MMSI are dropped along with its values and ones
+// naming the new MMSI are bound when the slot is renamed.
+void AISTarget::assign(uint32_t mmsi, uint32_t now) {
+    this->mmsi = mmsi;
+    lastHeardMs = now;
+    changes = CHANGED_IDENTITY;
+    latitude = aisLatitudeNotAvailable;
+    longitude = aisLongitudeNotAvailable;
+    speedOverGround = aisSpeedNotAvailable;
+    courseOverGround = aisCourseNotAvailable;
+    trueHeading = aisHeadingNotAvailable;
+    name.clear();
+}
+
+// Empties the slot, clearing the retained values published for the old target so that subscribers
+// see it go away.
+void AISTarget::release() {
+    clearValues();
+    node.dropNamedSubscriptions();
+
+    mmsi = 0;
+    mmsiName[0] = 0;
+    changes = 0;
+}
+
+// The removals are published straight away, since the node is renamed or emptied right after and
+// they have to go out under the old target's MMSI.
+void AISTarget::clearValues() {
+    latitudeLeaf.removeValueNow();
+    longitudeLeaf.removeValueNow();
+    speedOverGroundLeaf.removeValueNow();
+    courseOverGroundLeaf.removeValueNow();
+    headingLeaf.removeValueNow();
+    nameLeaf.removeValueNow();
+}
+
+void AISTarget::update(const AISMessage &message, uint32_t now) {
+    lastHeardMs = now;
+
+    if (message.has(AIS_CONTENTS_POSITION)) {
+        if (message.latitude != latitude || message.longitude != longitude) {
+            latitude = message.latitude;
+            longitude = message.longitude;
+            changes |= CHANGED_POSITION;
+        }
+        if (message.speedOverGround != speedOverGround) {
+            speedOverGround = message.speedOverGround;
+            changes |= CHANGED_SPEED;
+        }
+        if (message.courseOverGround != courseOverGround) {
+            courseOverGround = message.courseOverGround;
+            changes |= CHANGED_COURSE;
+        }
+        if (message.trueHeading != trueHeading) {
+            trueHeading = message.trueHeading;
+            changes |= CHANGED_HEADING;
+        }
+    }
+
+    if (message.has(AIS_CONTENTS_NAME) && name.compare(message.name) != 0) {
+        name = message.name;
+        changes |= CHANGED_NAME;
+    }
+}
+
+// A slot that has never been published, or was released, can go out straight away.
+bool AISTarget::publishDue(uint32_t now, uint32_t minPublishIntervalMs) const {
+    if (!changes) {
+        return false;
+    }
+
+    return mmsiName[0] == 0 || now - lastPublishedMs >= minPublishIntervalMs;
+}
+
+void AISTarget::publish(uint32_t now) {
+    if (changes & CHANGED_IDENTITY) {
+        clearValues();
+        node.dropNamedSubscriptions();
+
+        etl::string<mmsiNameLength> mmsiStr;
+        etl::to_string(mmsi, mmsiStr);
+        strcpy(mmsiName, mmsiStr.c_str());
+        node.bindNamedSubscriptions();
+
+        changes = CHANGED_ALL;
+    }
+
+    if (changes & CHANGED_POSITION) {
+        if (latitude == aisLatitudeNotAvailable || longitude == aisLongitudeNotAvailable) {
+            latitudeLeaf.removeValue();
+            longitudeLeaf.removeValue();
+        } else {
+            publishCoordinate(latitudeLeaf, latitude, "N", "S");
+            publishCoordinate(longitudeLeaf, longitude, "E", "W");
+        }
+    }
+
+    if (changes & CHANGED_SPEED) {
+        if (speedOverGround == aisSpeedNotAvailable) {
+            speedOverGroundLeaf.removeValue();
+        } else {
+            speedOverGroundLeaf.set(speedOverGround / 10, speedOverGround % 10);
+        }
+    }
+
+    if (changes & CHANGED_COURSE) {
+        if (courseOverGround >= aisCourseNotAvailable) {
+            courseOverGroundLeaf.removeValue();
+        } else {
+            courseOverGroundLeaf.set(courseOverGround / 10, courseOverGround % 10);
+        }
+    }
+
+    if (changes & CHANGED_HEADING) {
+        if (trueHeading == aisHeadingNotAvailable) {
+            headingLeaf.removeValue();
+        } else {
+            headingLeaf = trueHeading;
+        }
+    }
+
+    if (changes & CHANGED_NAME) {
+        if (name.empty()) {
+            nameLeaf.removeValue();
+        } else {
+            nameLeaf = name;
+        }
+    }
+
+    changes = 0;
+    lastPublishedMs = now;
+}
+
+// AIS coordinates are signed, in 1/10000 minute.
+void AISTarget::publishCoordinate(DataModelStringLeaf &leaf, int32_t coordinate,
+                                  const char *positiveSuffix, const char *negativeSuffix) {
+    const uint32_t magnitude = coordinate < 0 ? -coordinate : coordinate;
+    const uint32_t tenThousandthsPerDegree = 60 * 10000;
+
+    etl::string<coordinateLength> coordinateStr;
+    NMEACoordinate::format(coordinateStr, magnitude / tenThousandthsPerDegree,
+                           (magnitude % tenThousandthsPerDegree) * 100, 4, " ");
+    coordinateStr += ' ';
+    coordinateStr += coordinate < 0 ? negativeSuffix : positiveSuffix;
+
+    leaf = coordinateStr;
+}
@@ -0,0 +1,96 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AIS_TARGET_H
+#define AIS_TARGET_H
+
+#include "AISMessage.h"
+
+#include "DataModel/DataModel.h"
+#include "DataModel/DataModelSlotNode.h"
+#include "DataModel/DataModelStringLeaf.h"
+#include "DataModel/DataModelTenthsUInt16Leaf.h"
+#include "DataModel/DataModelUInt16Leaf.h"
+
+#include <etl/string.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// One slot of the AIS target table. Each slot has its own Data Model node under ais, whose name
+// is the MMSI of the target currently held in the slot. Values from the target's messages are
+// staged in the slot with flags noting what changed, and only go out to the Data Model when the
+// table decides the target is due to be published.
+class AISTarget {
+    private:
+        enum Change : uint8_t {
+            CHANGED_POSITION = 0x01,
+            CHANGED_SPEED = 0x02,
+            CHANGED_COURSE = 0x04,
+            CHANGED_HEADING = 0x08,
+            CHANGED_NAME = 0x10,
+            CHANGED_IDENTITY = 0x20,
+            CHANGED_ALL = 0x3f
+        };
+
+        // MMSIs are 30 bit fields, which can run to 10 digits even though valid ones have 9.
+        static const size_t mmsiNameLength = 10;
+        static const size_t leafCount = aisTargetLeaves;
+
+        char mmsiName[mmsiNameLength + 1];
+        DataModelElement *children[leafCount + 1];
+        DataModelSlotNode node;
+        etl::string<coordinateLength> latitudeBuffer;
+        DataModelStringLeaf latitudeLeaf;
+        etl::string<coordinateLength> longitudeBuffer;
+        DataModelStringLeaf longitudeLeaf;
+        DataModelTenthsUInt16Leaf speedOverGroundLeaf;
+        DataModelTenthsUInt16Leaf courseOverGroundLeaf;
+        DataModelUInt16Leaf headingLeaf;
+        etl::string<aisNameLength> nameBuffer;
+        DataModelStringLeaf nameLeaf;
+
+        uint32_t mmsi;
+        uint32_t lastHeardMs;
+        uint32_t lastPublishedMs;
+        uint8_t changes;
+        int32_t latitude;
+        int32_t longitude;
+        uint16_t speedOverGround;
+        uint16_t courseOverGround;
+        uint16_t trueHeading;
+        etl::string<aisNameLength> name;
+
+        void clearValues();
+        static void publishCoordinate(DataModelStringLeaf &leaf, int32_t coordinate,
+                                      const char *positiveSuffix, const char *negativeSuffix);
+
+    public:
+        AISTarget();
+        DataModelElement *dataModelNode();
+        bool inUse() const;
+        uint32_t targetMMSI() const;
+        uint32_t lastHeard() const;
+        void assign(uint32_t mmsi, uint32_t now);
+        void release();
+        void update(const AISMessage &message, uint32_t now);
+        bool publishDue(uint32_t now, uint32_t minPublishIntervalMs) const;
+        void publish(uint32_t now);
+};
+
+#endif
@@ -0,0 +1,193 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AISTargetTable.h"
+#include "AISTarget.h"
+#include "AISMessage.h"
+
+#include "DataModel/DataModel.h"
+
+#include "StatsManager/StatsManager.h"
+
+#include <Arduino.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+AISTargetTable::AISTargetTable(StatsManager &statsManager)
+    : targetCount(0), publishCursor(0), maxPublishesPerService(2), minPublishIntervalMs(2000),
+      targetTimeoutMs(10 * 60 * 1000), evictions(0) {
+    for (uint8_t slot = 0; slot < aisMaxTargets; slot++) {
+        aisNodeChildren[slot] = targets[slot].dataModelNode();
+    }
+    aisNodeChildren[aisMaxTargets] = NULL;
+
+    for (size_t position = 0; position < indexSize; position++) {
+        index[position] = noSlot;
+    }
+
+    statsManager.addStatsHolder(this);
+}
+
+void AISTargetTable::setMinPublishInterval(uint32_t milliSeconds) {
+    minPublishIntervalMs = milliSeconds;
+}
+
+void AISTargetTable::setMaxPublishesPerService(uint8_t maxPublishes) {
+    maxPublishesPerService = maxPublishes;
+}
+
+void AISTargetTable::setTargetTimeout(uint32_t milliSeconds) {
+    targetTimeoutMs = milliSeconds;
+}
+
+// Fibonacci hashing, taking the top bits of the product so that MMSIs sharing their low digits,
+// as those from the same country and fleet often do, still spread across the index.
+size_t AISTargetTable::homePosition(uint32_t mmsi) {
+    return (mmsi * 2654435761u) >> 27;
+}
+
+size_t AISTargetTable::findPosition(uint32_t mmsi) const {
+    size_t position = homePosition(mmsi);
+    while (index[position] != noSlot) {
+        if (targets[index[position]].targetMMSI() == mmsi) {
+            return position;
+        }
+        position = (position + 1) & (indexSize - 1);
+    }
+
+    return indexSize;
+}
+
+void AISTargetTable::insertIntoIndex(uint8_t slot) {
+    size_t position = homePosition(targets[slot].targetMMSI());
+    while (index[position] != noSlot) {
+        position = (position + 1) & (indexSize - 1);
+    }
+
+    index[position] = slot;
+}
+
+// Deletes by shifting later entries of the probe sequence back into the hole, so that lookups
+// never need tombstones and the index doesn't degrade as targets come and go.
+void AISTargetTable::removeFromIndex(size_t position) {
+    size_t hole = position;
+    size_t next = position;
+
+    while (true) {
+        next = (next + 1) & (indexSize - 1);
+        if (index[next] == noSlot) {
+            break;
+        }
+
+        // The entry can fill the hole only if its home position isn't cyclically between the
+        // hole and where it sits now.
+        const size_t home = homePosition(targets[index[next]].targetMMSI());
+        const size_t distanceToHole = (hole - home) & (indexSize - 1);
+        const size_t distanceToNext = (next - home) & (indexSize - 1);
+        if (distanceToHole < distanceToNext) {
+            index[hole] = index[next];
+            hole = next;
+        }
+    }
+
+    index[hole] = noSlot;
+}
+
+void AISTargetTable::removeTarget(uint8_t slot) {
+    removeFromIndex(findPosition(targets[slot].targetMMSI()));
+    targets[slot].release();
+    targetCount--;
+}
+
+uint8_t AISTargetTable::leastRecentlyHeard() const {
+    uint8_t oldestSlot = 0;
+    for (uint8_t slot = 1; slot < aisMaxTargets; slot++) {
+        if (targets[slot].lastHeard() - targets[oldestSlot].lastHeard() > 0x80000000) {
+            oldestSlot = slot;
+        }
+    }
+
+    return oldestSlot;
+}
+
+AISTarget &AISTargetTable::lookupOrAssign(uint32_t mmsi, uint32_t now) {
+    const size_t position = findPosition(mmsi);
+    if (position != indexSize) {
+        return targets[index[position]];
+    }
+
+    uint8_t slot;
+    if (targetCount == aisMaxTargets) {
+        slot = leastRecentlyHeard();
+        removeFromIndex(findPosition(targets[slot].targetMMSI()));
+        targetCount--;
+        evictions++;
+    } else {
+        for (slot = 0; targets[slot].inUse(); slot++) {
+        }
+    }
+
+    targets[slot].assign(mmsi, now);
+    insertIntoIndex(slot);
+    targetCount++;
+
+    return targets[slot];
+}
+
+void AISTargetTable::processAISMessage(const AISMessage &message) {
+    // Our own vessel's position is already published under gps.
+    if (message.ownShip || message.mmsi == 0) {
+        return;
+    }
+
+    if (!message.has(AIS_CONTENTS_POSITION) && !message.has(AIS_CONTENTS_NAME)) {
+        return;
+    }
+
+    const uint32_t now = millis();
+    lookupOrAssign(message.mmsi, now).update(message, now);
+}
+
+void AISTargetTable::service() {
+    const uint32_t now = millis();
+    uint8_t published = 0;
+
+    for (size_t checked = 0; checked < aisMaxTargets && published < maxPublishesPerService;
+         checked++) {
+        const uint8_t slot = publishCursor;
+        publishCursor = (publishCursor + 1) % aisMaxTargets;
+
+        AISTarget &target = targets[slot];
+        if (!target.inUse()) {
+            continue;
+        }
+
+        if (now - target.lastHeard() >= targetTimeoutMs) {
+            removeTarget(slot);
+        } else if (target.publishDue(now, minPublishIntervalMs)) {
+            target.publish(now);
+            published++;
+        }
+    }
+}
+
+void AISTargetTable::exportStats(__attribute__((unused)) uint32_t msElapsed) {
+    sysAISTargets << targetCount;
+    sysAISTargetsEvicted << evictions;
+}
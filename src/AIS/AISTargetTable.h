@@ -0,0 +1,73 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AIS_TARGET_TABLE_H
+#define AIS_TARGET_TABLE_H
+
+class AISMessage;
+class StatsManager;
+
+#include "AISMessageHandler.h"
+#include "AISTarget.h"
+
+#include "DataModel/DataModel.h"
+
+#include "StatsManager/StatsHolder.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Tracks the most recently heard AIS targets in a fixed number of slots, publishing each under
+// ais/<mmsi>. Targets are found by MMSI through a small open addressed hash index. When the table
+// is full, the target heard from least recently gives up its slot to the new one. Targets are
+// published from service(), a few per call and each no more often than the minimum publish
+// interval, so that a busy harbour doesn't flood the Data Model's subscribers.
+class AISTargetTable : public AISMessageHandler, public StatsHolder {
+    private:
+        // Power of two, with enough spare entries to keep the probe sequences short.
+        static const size_t indexSize = 32;
+        static const uint8_t noSlot = 0xff;
+
+        AISTarget targets[aisMaxTargets];
+        uint8_t index[indexSize];
+        uint8_t targetCount;
+        uint8_t publishCursor;
+        uint8_t maxPublishesPerService;
+        uint32_t minPublishIntervalMs;
+        uint32_t targetTimeoutMs;
+        uint32_t evictions;
+
+        static size_t homePosition(uint32_t mmsi);
+        size_t findPosition(uint32_t mmsi) const;
+        AISTarget &lookupOrAssign(uint32_t mmsi, uint32_t now);
+        void insertIntoIndex(uint8_t slot);
+        void removeFromIndex(size_t position);
+        void removeTarget(uint8_t slot);
+        uint8_t leastRecentlyHeard() const;
+
+    public:
+        AISTargetTable(StatsManager &statsManager);
+        void setMinPublishInterval(uint32_t milliSeconds);
+        void setMaxPublishesPerService(uint8_t maxPublishes);
+        void setTargetTimeout(uint32_t milliSeconds);
+        virtual void processAISMessage(const AISMessage &message) override;
+        void service();
+        virtual void exportStats(uint32_t msElapsed) override;
+};
+
+#endif
@@ -28,11 +28,13 @@
 #include "DataModelHundredthsUInt8Leaf.h"
 #include "DataModelHundredthsUInt16Leaf.h"
 #include "DataModelStringLeaf.h"
+#include "DataModelLeafSet.h"
+#include "DataModelSlotNode.h"
 #include "Config.h"
-#include "Version.h"
 
 #include "StatsManager/StatCounter.h"
 #include "StatsManager/StatsManager.h"
+#include "StatsManager/LoopProfiler.h"
 
 #include "Util/Logger.h"
 #include "Util/Error.h"
@@ -40,22 +42,35 @@
 #include <etl/string.h>
 
 #include <stdint.h>
+#include <string.h>
+
+#include <Arduino.h>
+
+// Each leaf defined here is marked with FIXED_LEAF, which bumps __COUNTER__, so that the number of
+// them can be checked against dataModelFixedLeaves once they're all defined.
+static const unsigned fixedLeafCounterBase = __COUNTER__;
+#define FIXED_LEAF static_assert(__COUNTER__ > fixedLeafCounterBase, "");
 
 static etl::string<maxConnectionDescriptionLength> sysBrokerConnection1Buffer;
-DataModelStringLeaf sysBrokerConnection1("1", &sysBrokerConnectionsNode,
-                                         sysBrokerConnection1Buffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerConnection1("$SYS/broker/connections/1",
+                                                    &sysBrokerConnectionsNode,
+                                                    sysBrokerConnection1Buffer);
 static etl::string<maxConnectionDescriptionLength> sysBrokerConnection2Buffer;
-DataModelStringLeaf sysBrokerConnection2("2", &sysBrokerConnectionsNode,
-                                         sysBrokerConnection2Buffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerConnection2("$SYS/broker/connections/2",
+                                                    &sysBrokerConnectionsNode,
+                                                    sysBrokerConnection2Buffer);
 static etl::string<maxConnectionDescriptionLength> sysBrokerConnection3Buffer;
-DataModelStringLeaf sysBrokerConnection3("3", &sysBrokerConnectionsNode,
-                                         sysBrokerConnection3Buffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerConnection3("$SYS/broker/connections/3",
+                                                    &sysBrokerConnectionsNode,
+                                                    sysBrokerConnection3Buffer);
 static etl::string<maxConnectionDescriptionLength> sysBrokerConnection4Buffer;
-DataModelStringLeaf sysBrokerConnection4("4", &sysBrokerConnectionsNode,
-                                         sysBrokerConnection4Buffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerConnection4("$SYS/broker/connections/4",
+                                                    &sysBrokerConnectionsNode,
+                                                    sysBrokerConnection4Buffer);
 static etl::string<maxConnectionDescriptionLength> sysBrokerConnection5Buffer;
-DataModelStringLeaf sysBrokerConnection5("5", &sysBrokerConnectionsNode,
-                                         sysBrokerConnection5Buffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerConnection5("$SYS/broker/connections/5",
+                                                    &sysBrokerConnectionsNode,
+                                                    sysBrokerConnection5Buffer);
 
 DataModelStringLeaf *sysBrokerConnectionDebugs[] = {
     &sysBrokerConnection1,
@@ -77,15 +92,20 @@ DataModelNode sysBrokerConnectionsNode("connections", &sysBrokerNode,
                                        sysBrokerConnectionsNodeChildren);
 
 static etl::string<maxSessionDescriptionLength> sysBrokerSession1Buffer;
-DataModelStringLeaf sysBrokerSession1("1", &sysBrokerSessionsNode, sysBrokerSession1Buffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerSession1("$SYS/broker/sessions/1", &sysBrokerSessionsNode,
+                                                 sysBrokerSession1Buffer);
 static etl::string<maxSessionDescriptionLength> sysBrokerSession2Buffer;
-DataModelStringLeaf sysBrokerSession2("2", &sysBrokerSessionsNode, sysBrokerSession2Buffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerSession2("$SYS/broker/sessions/2", &sysBrokerSessionsNode,
+                                                 sysBrokerSession2Buffer);
 static etl::string<maxSessionDescriptionLength> sysBrokerSession3Buffer;
-DataModelStringLeaf sysBrokerSession3("3", &sysBrokerSessionsNode, sysBrokerSession3Buffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerSession3("$SYS/broker/sessions/3", &sysBrokerSessionsNode,
+                                                 sysBrokerSession3Buffer);
 static etl::string<maxSessionDescriptionLength> sysBrokerSession4Buffer;
-DataModelStringLeaf sysBrokerSession4("4", &sysBrokerSessionsNode, sysBrokerSession4Buffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerSession4("$SYS/broker/sessions/4", &sysBrokerSessionsNode,
+                                                 sysBrokerSession4Buffer);
 static etl::string<maxSessionDescriptionLength> sysBrokerSession5Buffer;
-DataModelStringLeaf sysBrokerSession5("5", &sysBrokerSessionsNode, sysBrokerSession5Buffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerSession5("$SYS/broker/sessions/5", &sysBrokerSessionsNode,
+                                                 sysBrokerSession5Buffer);
 
 DataModelStringLeaf *sysBrokerSessionDebugs[] = {
     &sysBrokerSession1,
@@ -105,10 +125,14 @@ DataModelElement *sysBrokerSessionsNodeChildren[] = {
 };
 DataModelNode sysBrokerSessionsNode("sessions", &sysBrokerNode, sysBrokerSessionsNodeChildren);
 
-DataModelUInt32Leaf sysBrokerClientsConnected("connected", &sysBrokerClientsNode);
-DataModelUInt32Leaf sysBrokerClientsDisconnected("disconnected", &sysBrokerClientsNode);
-DataModelUInt32Leaf sysBrokerClientsMaximum("maximum", &sysBrokerClientsNode);
-DataModelUInt32Leaf sysBrokerClientsTotal("total", &sysBrokerClientsNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerClientsConnected("$SYS/broker/clients/connected",
+                                                         &sysBrokerClientsNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerClientsDisconnected("$SYS/broker/clients/disconnected",
+                                                            &sysBrokerClientsNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerClientsMaximum("$SYS/broker/clients/maximum",
+                                                       &sysBrokerClientsNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerClientsTotal("$SYS/broker/clients/total",
+                                                     &sysBrokerClientsNode);
 
 DataModelElement *sysBrokerClientsChildren[] = {
     &sysBrokerClientsConnected,
@@ -119,7 +143,8 @@ DataModelElement *sysBrokerClientsChildren[] = {
 };
 DataModelNode sysBrokerClientsNode("clients", &sysBrokerNode, sysBrokerClientsChildren);
 
-DataModelUInt16Leaf sysBrokerMessagesRetainedCount("count", &sysBrokerMessagesRetainedNode);
+FIXED_LEAF DataModelUInt16Leaf sysBrokerMessagesRetainedCount("$SYS/broker/messages/retained/count",
+                                                              &sysBrokerMessagesRetainedNode);
 
 DataModelElement *sysBrokerMessagesRetainedChildren[] = {
     &sysBrokerMessagesRetainedCount,
@@ -128,22 +153,30 @@ DataModelElement *sysBrokerMessagesRetainedChildren[] = {
 DataModelNode sysBrokerMessagesRetainedNode("retained", &sysBrokerMessagesNode,
                                             sysBrokerMessagesRetainedChildren);
 
-DataModelUInt32Leaf sysBrokerMessagesPublishReceived("received", &sysBrokerMessagesPublishNode);
-DataModelUInt32Leaf sysBrokerMessagesPublishSent("sent", &sysBrokerMessagesPublishNode);
-DataModelUInt32Leaf sysBrokerMessagesPublishDropped("dropped", &sysBrokerMessagesPublishNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerMessagesPublishReceived(
+    "$SYS/broker/messages/publish/received", &sysBrokerMessagesPublishNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerMessagesPublishSent("$SYS/broker/messages/publish/sent",
+                                                            &sysBrokerMessagesPublishNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerMessagesPublishDropped(
+    "$SYS/broker/messages/publish/dropped", &sysBrokerMessagesPublishNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerPublishBudgetExhaustions(
+    "$SYS/broker/messages/publish/budgetExhaustions", &sysBrokerMessagesPublishNode);
 
 
 DataModelElement *sysBrokerMessagesPublishChildren[] = {
     &sysBrokerMessagesPublishReceived,
     &sysBrokerMessagesPublishSent,
     &sysBrokerMessagesPublishDropped,
+    &sysBrokerPublishBudgetExhaustions,
     NULL
 };
 DataModelNode sysBrokerMessagesPublishNode("publish", &sysBrokerMessagesNode,
                                            sysBrokerMessagesPublishChildren);
 
-DataModelUInt32Leaf sysBrokerMessagesReceived("received", &sysBrokerMessagesNode);
-DataModelUInt32Leaf sysBrokerMessagesSent("sent", &sysBrokerMessagesNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerMessagesReceived("$SYS/broker/messages/received",
+                                                         &sysBrokerMessagesNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerMessagesSent("$SYS/broker/messages/sent",
+                                                     &sysBrokerMessagesNode);
 
 DataModelElement *sysBrokerMessagesChildren[] = {
     &sysBrokerMessagesReceived,
@@ -154,7 +187,8 @@ DataModelElement *sysBrokerMessagesChildren[] = {
 };
 DataModelNode sysBrokerMessagesNode("messages", &sysBrokerNode, sysBrokerMessagesChildren);
 
-DataModelUInt32Leaf sysBrokerSubscriptionsCount("count", &sysBrokerSubscriptionsNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerSubscriptionsCount("$SYS/broker/subscriptions/count",
+                                                           &sysBrokerSubscriptionsNode);
 
 DataModelElement *sysBrokerSubscriptionsChildren[] = {
     &sysBrokerSubscriptionsCount,
@@ -163,9 +197,10 @@ DataModelElement *sysBrokerSubscriptionsChildren[] = {
 DataModelNode sysBrokerSubscriptionsNode("subscriptions", &sysBrokerNode,
                                          sysBrokerSubscriptionsChildren);
 
-DataModelUInt32Leaf sysBrokerUptime("uptime", &sysBrokerNode);
+FIXED_LEAF DataModelUInt32Leaf sysBrokerUptime("$SYS/broker/uptime", &sysBrokerNode);
 static etl::string<maxVersionLength> sysBrokerVersionBuffer;
-DataModelStringLeaf sysBrokerVersion("version", &sysBrokerNode, sysBrokerVersionBuffer);
+FIXED_LEAF DataModelStringLeaf sysBrokerVersion("$SYS/broker/version", &sysBrokerNode,
+                                                sysBrokerVersionBuffer);
 
 DataModelElement *sysBrokerChildren[] = {
     &sysBrokerConnectionsNode,
@@ -179,24 +214,52 @@ DataModelElement *sysBrokerChildren[] = {
 };
 DataModelNode sysBrokerNode("broker", &sysNode, sysBrokerChildren);
 
-DataModelBoolLeaf sysNEMAWiFiState("state", &sysNMEAWiFiNode);
-DataModelLeaf sysNMEAWiFiMessages("messages", &sysNMEAWiFiNode);
-DataModelLeaf sysNMEAWiFiMessageRate("messageRate", &sysNMEAWiFiNode);
+FIXED_LEAF DataModelBoolLeaf sysNEMAWiFiState("$SYS/nmea/wifi/state", &sysNMEAWiFiNode);
+FIXED_LEAF DataModelLeaf sysNMEAWiFiMessages("$SYS/nmea/wifi/messages", &sysNMEAWiFiNode);
+FIXED_LEAF DataModelLeaf sysNMEAWiFiMessageRate("$SYS/nmea/wifi/messageRate", &sysNMEAWiFiNode);
+FIXED_LEAF DataModelLeaf sysNMEAWiFiBacklog("$SYS/nmea/wifi/backlog", &sysNMEAWiFiNode);
+FIXED_LEAF DataModelLeaf sysNMEAWiFiBudgetExhaustions("$SYS/nmea/wifi/budgetExhaustions",
+                                                      &sysNMEAWiFiNode);
+FIXED_LEAF DataModelLeaf sysNMEAWiFiOverlengthLines("$SYS/nmea/wifi/overlengthLines",
+                                                    &sysNMEAWiFiNode);
+FIXED_LEAF DataModelLeaf sysNMEAWiFiDuplicates("$SYS/nmea/wifi/duplicates", &sysNMEAWiFiNode);
+static etl::string<maxNMEAFilteredLength> sysNMEAWiFiFilteredBuffer;
+FIXED_LEAF DataModelStringLeaf sysNMEAWiFiFiltered("$SYS/nmea/wifi/filtered", &sysNMEAWiFiNode,
+                                                   sysNMEAWiFiFilteredBuffer);
 
 DataModelElement *sysNMEAWiFiNodeChildren[] = {
     &sysNEMAWiFiState,
     &sysNMEAWiFiMessages,
     &sysNMEAWiFiMessageRate,
+    &sysNMEAWiFiBacklog,
+    &sysNMEAWiFiBudgetExhaustions,
+    &sysNMEAWiFiOverlengthLines,
+    &sysNMEAWiFiFiltered,
+    &sysNMEAWiFiDuplicates,
     NULL
 };
 DataModelNode sysNMEAWiFiNode("wifi", &sysNMEANode, sysNMEAWiFiNodeChildren);
 
-DataModelLeaf sysNMEAUSBMessages("messages", &sysNMEAUSBNode);
-DataModelLeaf sysNMEAUSBMessageRate("messageRate", &sysNMEAUSBNode);
+FIXED_LEAF DataModelLeaf sysNMEAUSBMessages("$SYS/nmea/usb/messages", &sysNMEAUSBNode);
+FIXED_LEAF DataModelLeaf sysNMEAUSBMessageRate("$SYS/nmea/usb/messageRate", &sysNMEAUSBNode);
+FIXED_LEAF DataModelLeaf sysNMEAUSBBacklog("$SYS/nmea/usb/backlog", &sysNMEAUSBNode);
+FIXED_LEAF DataModelLeaf sysNMEAUSBBudgetExhaustions("$SYS/nmea/usb/budgetExhaustions",
+                                                     &sysNMEAUSBNode);
+FIXED_LEAF DataModelLeaf sysNMEAUSBOverlengthLines("$SYS/nmea/usb/overlengthLines",
+                                                   &sysNMEAUSBNode);
+FIXED_LEAF DataModelLeaf sysNMEAUSBDuplicates("$SYS/nmea/usb/duplicates", &sysNMEAUSBNode);
+static etl::string<maxNMEAFilteredLength> sysNMEAUSBFilteredBuffer;
+FIXED_LEAF DataModelStringLeaf sysNMEAUSBFiltered("$SYS/nmea/usb/filtered", &sysNMEAUSBNode,
+                                                  sysNMEAUSBFilteredBuffer);
 
 DataModelElement *sysNMEAUSBNodeChildren[] = {
     &sysNMEAUSBMessages,
     &sysNMEAUSBMessageRate,
+    &sysNMEAUSBBacklog,
+    &sysNMEAUSBBudgetExhaustions,
+    &sysNMEAUSBOverlengthLines,
+    &sysNMEAUSBFiltered,
+    &sysNMEAUSBDuplicates,
     NULL
 };
 DataModelNode sysNMEAUSBNode("usb", &sysNMEANode, sysNMEAUSBNodeChildren);
@@ -208,37 +271,52 @@ DataModelElement *sysNMEANodeChildren[] = {
 };
 DataModelNode sysNMEANode("nmea", &sysNode, sysNMEANodeChildren);
 
-DataModelLeaf sysDataModelLeafUpdates("updates", &sysDataModelNode);
-DataModelLeaf sysDataModelLeafUpdateRate("updateRate", &sysDataModelNode);
+FIXED_LEAF DataModelLeaf sysDataModelLeafUpdates("$SYS/dataModel/updates", &sysDataModelNode);
+FIXED_LEAF DataModelLeaf sysDataModelLeafUpdateRate("$SYS/dataModel/updateRate", &sysDataModelNode);
+FIXED_LEAF DataModelUInt16Leaf sysDataModelLeaves("$SYS/dataModel/leaves", &sysDataModelNode);
 
 DataModelElement *sysDataModelNodeChildren[] = {
     &sysDataModelLeafUpdates,
     &sysDataModelLeafUpdateRate,
+    &sysDataModelLeaves,
     NULL
 };
 DataModelNode sysDataModelNode("dataModel", &sysNode, sysDataModelNodeChildren);
 
-DataModelLeaf sysNMEADataModelMessagesBridged("messages", &sysNMEADataModelBridgeNode);
-DataModelLeaf sysNMEADataModelMessageBridgeRate("messageRate", &sysNMEADataModelBridgeNode);
+FIXED_LEAF DataModelLeaf sysNMEADataModelMessagesBridged("$SYS/nmeaDataModelBridge/messages",
+                                                         &sysNMEADataModelBridgeNode);
+FIXED_LEAF DataModelLeaf sysNMEADataModelMessageBridgeRate("$SYS/nmeaDataModelBridge/messageRate",
+                                                           &sysNMEADataModelBridgeNode);
+FIXED_LEAF DataModelLeaf sysNMEADataModelEpochs("$SYS/nmeaDataModelBridge/epochs",
+                                                &sysNMEADataModelBridgeNode);
+FIXED_LEAF DataModelLeaf sysNMEADataModelEpochTimeouts("$SYS/nmeaDataModelBridge/epochTimeouts",
+                                                       &sysNMEADataModelBridgeNode);
+FIXED_LEAF DataModelLeaf sysNMEADataModelSatellitesDropped(
+    "$SYS/nmeaDataModelBridge/satellitesDropped", &sysNMEADataModelBridgeNode);
 
 DataModelElement *sysNMEADataModelBridgeNodeChildren[] = {
     &sysNMEADataModelMessagesBridged,
     &sysNMEADataModelMessageBridgeRate,
+    &sysNMEADataModelEpochs,
+    &sysNMEADataModelEpochTimeouts,
+    &sysNMEADataModelSatellitesDropped,
     NULL
 };
 DataModelNode sysNMEADataModelBridgeNode("nmeaDataModelBridge", &sysNode,
                                          sysNMEADataModelBridgeNodeChildren);
 
 static etl::string<maxLogEntryLength> sysLogEntry1Buffer;
-DataModelStringLeaf sysLogEntry1("1", &sysLogNode, sysLogEntry1Buffer);
+FIXED_LEAF DataModelStringLeaf sysLogEntry1("$SYS/log/1", &sysLogNode, sysLogEntry1Buffer);
 static etl::string<maxLogEntryLength> sysLogEntry2Buffer;
-DataModelStringLeaf sysLogEntry2("2", &sysLogNode, sysLogEntry2Buffer);
+FIXED_LEAF DataModelStringLeaf sysLogEntry2("$SYS/log/2", &sysLogNode, sysLogEntry2Buffer);
 static etl::string<maxLogEntryLength> sysLogEntry3Buffer;
-DataModelStringLeaf sysLogEntry3("3", &sysLogNode, sysLogEntry3Buffer);
+FIXED_LEAF DataModelStringLeaf sysLogEntry3("$SYS/log/3", &sysLogNode, sysLogEntry3Buffer);
 static etl::string<maxLogEntryLength> sysLogEntry4Buffer;
-DataModelStringLeaf sysLogEntry4("4", &sysLogNode, sysLogEntry4Buffer);
+FIXED_LEAF DataModelStringLeaf sysLogEntry4("$SYS/log/4", &sysLogNode, sysLogEntry4Buffer);
 static etl::string<maxLogEntryLength> sysLogEntry5Buffer;
-DataModelStringLeaf sysLogEntry5("5", &sysLogNode, sysLogEntry5Buffer);
+FIXED_LEAF DataModelStringLeaf sysLogEntry5("$SYS/log/5", &sysLogNode, sysLogEntry5Buffer);
+
+FIXED_LEAF DataModelUInt32Leaf sysLogDroppedLines("$SYS/log/droppedLines", &sysLogNode);
 
 DataModelStringLeaf *sysLogEntries[logEntrySlots] = {
     &sysLogEntry1,
@@ -254,73 +332,134 @@ DataModelElement *sysLogNodeChildren[] = {
     &sysLogEntry3,
     &sysLogEntry4,
     &sysLogEntry5,
+    &sysLogDroppedLines,
     NULL
 };
 DataModelNode sysLogNode("log", &sysNode, sysLogNodeChildren);
 
+#if LOOP_PROFILING
+DataModelElement *sysLoopNodeChildren[LOOP_STAGE_COUNT + 3];
+DataModelNode sysLoopNode("loop", &sysNode, sysLoopNodeChildren);
+#endif
+
+FIXED_LEAF DataModelLeaf sysAISMessages("$SYS/ais/messages", &sysAISNode);
+FIXED_LEAF DataModelLeaf sysAISMessageRate("$SYS/ais/messageRate", &sysAISNode);
+FIXED_LEAF DataModelLeaf sysAISUnsupported("$SYS/ais/unsupported", &sysAISNode);
+FIXED_LEAF DataModelLeaf sysAISBadMessages("$SYS/ais/badMessages", &sysAISNode);
+FIXED_LEAF DataModelLeaf sysAISFragmentsDropped("$SYS/ais/fragmentsDropped", &sysAISNode);
+FIXED_LEAF DataModelLeaf sysAISTargets("$SYS/ais/targets", &sysAISNode);
+FIXED_LEAF DataModelLeaf sysAISTargetsEvicted("$SYS/ais/targetsEvicted", &sysAISNode);
+
+DataModelElement *sysAISNodeChildren[] = {
+    &sysAISMessages,
+    &sysAISMessageRate,
+    &sysAISUnsupported,
+    &sysAISBadMessages,
+    &sysAISFragmentsDropped,
+    &sysAISTargets,
+    &sysAISTargetsEvicted,
+    NULL
+};
+DataModelNode sysAISNode("ais", &sysNode, sysAISNodeChildren);
+
 DataModelElement *sysNodeChildren[] = {
     &sysBrokerNode,
     &sysNMEANode,
+    &sysAISNode,
     &sysDataModelNode,
     &sysNMEADataModelBridgeNode,
     &sysLogNode,
+#if LOOP_PROFILING
+    &sysLoopNode,
+#endif
     NULL
 };
 DataModelNode sysNode("$SYS", &dataModelRoot, sysNodeChildren);
 
 etl::string<timeLength> gpsTimeBuffer;
-DataModelStringLeaf gpsTime("time", &gpsNode, gpsTimeBuffer);
+FIXED_LEAF DataModelStringLeaf gpsTime("gps/time", &gpsNode, gpsTimeBuffer);
 etl::string<dateLength> gpsDateBuffer;
-DataModelStringLeaf gpsDate("date", &gpsNode, gpsDateBuffer);
-DataModelBoolLeaf gpsDataValid("dataValid", &gpsNode);
+FIXED_LEAF DataModelStringLeaf gpsDate("gps/date", &gpsNode, gpsDateBuffer);
+etl::string<timestampLength> gpsTimestampBuffer;
+FIXED_LEAF DataModelStringLeaf gpsTimestamp("gps/timestamp", &gpsNode, gpsTimestampBuffer);
+FIXED_LEAF DataModelBoolLeaf gpsDataValid("gps/dataValid", &gpsNode);
 etl::string<coordinateLength> gpsLatitudeBuffer;
-DataModelStringLeaf gpsLatitude("latitude", &gpsNode, gpsLatitudeBuffer);
+FIXED_LEAF DataModelStringLeaf gpsLatitude("gps/latitude", &gpsNode, gpsLatitudeBuffer);
 etl::string<coordinateLength> positionLongitudeBuffer;
-DataModelStringLeaf gpsLongitude("longitude", &gpsNode, positionLongitudeBuffer);
-DataModelTenthsInt16Leaf gpsAltitude("altitude", &gpsNode);
-DataModelTenthsUInt16Leaf gpsSpeedOverGround("speedOverGround", &gpsNode);
-DataModelTenthsUInt16Leaf gpsSpeedOverGroundKmPerH("speedOverGroundKmPerH", &gpsNode);
-DataModelTenthsUInt16Leaf gpsTrackMadeGoodTrue("trackMadeGoodTrue", &gpsNode);
-DataModelTenthsUInt16Leaf gpsTrackMadeGoodMagnetic("trackMadeGoodMagnetic", &gpsNode);
-DataModelTenthsInt16Leaf gpsMagneticVariation("magneticVariation", &gpsNode);
+FIXED_LEAF DataModelStringLeaf gpsLongitude("gps/longitude", &gpsNode, positionLongitudeBuffer);
+FIXED_LEAF DataModelTenthsInt16Leaf gpsAltitude("gps/altitude", &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsSpeedOverGround("gps/speedOverGround", &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsSpeedOverGroundKmPerH("gps/speedOverGroundKmPerH",
+                                                              &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsTrackMadeGoodTrue("gps/trackMadeGoodTrue", &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsTrackMadeGoodMagnetic("gps/trackMadeGoodMagnetic",
+                                                              &gpsNode);
+FIXED_LEAF DataModelTenthsInt16Leaf gpsMagneticVariation("gps/magneticVariation", &gpsNode);
 etl::string<15> gpsFAAModeIndicatorBuffer;
-DataModelStringLeaf gpsFAAModeindicator("faaModeIndicator", &gpsNode,
-                                        gpsFAAModeIndicatorBuffer);
+FIXED_LEAF DataModelStringLeaf gpsFAAModeindicator("gps/faaModeIndicator", &gpsNode,
+                                                   gpsFAAModeIndicatorBuffer);
 etl::string<20> gpsGPSQualityBuffer;
-DataModelStringLeaf gpsGPSQuality("gpsQuality", &gpsNode, gpsGPSQualityBuffer);
-DataModelUInt16Leaf gpsNumberSatellites("numberSatellites", &gpsNode);
-DataModelHundredthsUInt16Leaf gpsHorizontalDilutionOfPrecision("horizontalDilutionOfPrecision",
+FIXED_LEAF DataModelStringLeaf gpsGPSQuality("gps/gpsQuality", &gpsNode, gpsGPSQualityBuffer);
+FIXED_LEAF DataModelUInt16Leaf gpsNumberSatellites("gps/numberSatellites", &gpsNode);
+FIXED_LEAF DataModelHundredthsUInt16Leaf gpsHorizontalDilutionOfPrecision(
+    "gps/horizontalDilutionOfPrecision", &gpsNode);
+FIXED_LEAF DataModelTenthsInt16Leaf gpsGeoidalSeparation("gps/geoidalSeparation", &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsDataAge("gps/dataAge", &gpsNode);
+FIXED_LEAF DataModelUInt16Leaf gpsDifferentialReferenceStation("gps/differentialReferenceStation",
                                                                &gpsNode);
-DataModelTenthsInt16Leaf gpsGeoidalSeparation("geoidalSeparation", &gpsNode);
-DataModelTenthsUInt16Leaf gpsDataAge("dataAge", &gpsNode);
-DataModelUInt16Leaf gpsDifferentialReferenceStation("differentialReferenceStation", &gpsNode);
 etl::string<9> gpsSatelliteSelectionModeBuffer;
-DataModelStringLeaf gpsSatelliteSelectionMode("satelliteSelectionMode", &gpsNode,
-                                              gpsSatelliteSelectionModeBuffer);
+FIXED_LEAF DataModelStringLeaf gpsSatelliteSelectionMode("gps/satelliteSelectionMode", &gpsNode,
+                                                         gpsSatelliteSelectionModeBuffer);
 etl::string<4> gpsFixModeBuffer;
-DataModelStringLeaf gpsFixMode("fixMode", &gpsNode, gpsFixModeBuffer);
+FIXED_LEAF DataModelStringLeaf gpsFixMode("gps/fixMode", &gpsNode, gpsFixModeBuffer);
 etl::string<activeSatellitesLength> gpsActiveSatellitesBuffer;
-DataModelStringLeaf gpsActiveSatellites("activeSatellites", &gpsNode, gpsActiveSatellitesBuffer);
-DataModelHundredthsUInt8Leaf gpsPDOP("pdop", &gpsNode);
-DataModelHundredthsUInt8Leaf gpsHDOP("hdop", &gpsNode);
-DataModelHundredthsUInt8Leaf gpsVDOP("vdop", &gpsNode);
-DataModelTenthsUInt16Leaf gpsStandardDeviationOfRangeInputsRMS("standardDeviationOfRangeInputsRMS",
-                                                               &gpsNode);
-DataModelTenthsUInt16Leaf gpsStandardDeviationOfSemiMajorAxis("standardDeviationOfSemiMajorAxis",
-                                                              &gpsNode);
-DataModelTenthsUInt16Leaf gpsStandardDeviationOfSemiMinorAxis("standardDeviationOfSemiMinorAxis",
-                                                              &gpsNode);
-DataModelTenthsUInt16Leaf gpsOrientationOfSemiMajorAxis("orientationOfSemiMajorAxis", &gpsNode);
-DataModelTenthsUInt16Leaf gpsStandardDeviationOfLatitudeError("standardDeviationOfLatitudeError",
-                                                              &gpsNode);
-DataModelTenthsUInt16Leaf gpsStandardDeviationOfLongitudeError("standardDeviationOfLongitudeError",
-                                                               &gpsNode);
-DataModelTenthsUInt16Leaf gpsStandardDeviationOfAltitudeError("standardDeviationOfAltitudeError",
-                                                              &gpsNode);
+FIXED_LEAF DataModelStringLeaf gpsActiveSatellites("gps/activeSatellites", &gpsNode,
+                                                   gpsActiveSatellitesBuffer);
+FIXED_LEAF DataModelHundredthsUInt8Leaf gpsPDOP("gps/pdop", &gpsNode);
+FIXED_LEAF DataModelHundredthsUInt8Leaf gpsHDOP("gps/hdop", &gpsNode);
+FIXED_LEAF DataModelHundredthsUInt8Leaf gpsVDOP("gps/vdop", &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsStandardDeviationOfRangeInputsRMS(
+    "gps/standardDeviationOfRangeInputsRMS", &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsStandardDeviationOfSemiMajorAxis(
+    "gps/standardDeviationOfSemiMajorAxis", &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsStandardDeviationOfSemiMinorAxis(
+    "gps/standardDeviationOfSemiMinorAxis", &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsOrientationOfSemiMajorAxis("gps/orientationOfSemiMajorAxis",
+                                                                   &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsStandardDeviationOfLatitudeError(
+    "gps/standardDeviationOfLatitudeError", &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsStandardDeviationOfLongitudeError(
+    "gps/standardDeviationOfLongitudeError", &gpsNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf gpsStandardDeviationOfAltitudeError(
+    "gps/standardDeviationOfAltitudeError", &gpsNode);
+
+// Filled in by the NMEA bridge's GSV satellite tables, with the number of satellites in view
+// followed by a node for each slot, named with the PRN of the satellite it holds.
+DataModelElement *gpsSatellitesGPSNodeChildren[gpsMaxSatellitesInView + 2];
+DataModelNode gpsSatellitesGPSNode("gps", &gpsSatellitesNode, gpsSatellitesGPSNodeChildren);
+DataModelElement *gpsSatellitesGLONASSNodeChildren[gpsMaxSatellitesInView + 2];
+DataModelNode gpsSatellitesGLONASSNode("glonass", &gpsSatellitesNode,
+                                       gpsSatellitesGLONASSNodeChildren);
+DataModelElement *gpsSatellitesGalileoNodeChildren[gpsMaxSatellitesInView + 2];
+DataModelNode gpsSatellitesGalileoNode("galileo", &gpsSatellitesNode,
+                                       gpsSatellitesGalileoNodeChildren);
+DataModelElement *gpsSatellitesBeiDouNodeChildren[gpsMaxSatellitesInView + 2];
+DataModelNode gpsSatellitesBeiDouNode("beidou", &gpsSatellitesNode,
+                                      gpsSatellitesBeiDouNodeChildren);
+
+DataModelElement *gpsSatellitesNodeChildren[] = {
+    &gpsSatellitesGPSNode,
+    &gpsSatellitesGLONASSNode,
+    &gpsSatellitesGalileoNode,
+    &gpsSatellitesBeiDouNode,
+    NULL
+};
+DataModelNode gpsSatellitesNode("satellites", &gpsNode, gpsSatellitesNodeChildren);
 
 DataModelElement *gpsNodeChildren[] = {
     &gpsTime,
     &gpsDate,
+    &gpsTimestamp,
     &gpsDataValid,
     &gpsLatitude,
     &gpsLongitude,
@@ -350,13 +489,17 @@ DataModelElement *gpsNodeChildren[] = {
     &gpsStandardDeviationOfLatitudeError,
     &gpsStandardDeviationOfLongitudeError,
     &gpsStandardDeviationOfAltitudeError,
+    &gpsSatellitesNode,
     NULL
 };
 DataModelNode gpsNode("gps", &dataModelRoot, gpsNodeChildren);
 
-DataModelTenthsUInt16Leaf depthBelowTransducerFeet("feet", &depthBelowTransducerNode);
-DataModelTenthsUInt16Leaf depthBelowTransducerMeters("meters", &depthBelowTransducerNode);
-DataModelTenthsUInt16Leaf depthBelowTransducerFathoms("fathoms", &depthBelowTransducerNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf depthBelowTransducerFeet("depth/belowTransducer/feet",
+                                                              &depthBelowTransducerNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf depthBelowTransducerMeters("depth/belowTransducer/meters",
+                                                                &depthBelowTransducerNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf depthBelowTransducerFathoms("depth/belowTransducer/fathoms",
+                                                                 &depthBelowTransducerNode);
 
 DataModelElement *depthBelowTransducerNodeChildren[] = {
     &depthBelowTransducerFeet,
@@ -367,9 +510,12 @@ DataModelElement *depthBelowTransducerNodeChildren[] = {
 DataModelNode depthBelowTransducerNode("belowTransducer", &depthNode,
                                        depthBelowTransducerNodeChildren);
 
-DataModelTenthsUInt16Leaf depthBelowKeelFeet("feet", &depthBelowKeelNode);
-DataModelTenthsUInt16Leaf depthBelowKeelMeters("meters", &depthBelowKeelNode);
-DataModelTenthsUInt16Leaf depthBelowKeelFathoms("fathoms", &depthBelowKeelNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf depthBelowKeelFeet("depth/belowKeel/feet",
+                                                        &depthBelowKeelNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf depthBelowKeelMeters("depth/belowKeel/meters",
+                                                          &depthBelowKeelNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf depthBelowKeelFathoms("depth/belowKeel/fathoms",
+                                                           &depthBelowKeelNode);
 
 DataModelElement *depthBelowKeelNodeChildren[] = {
     &depthBelowKeelFeet,
@@ -379,9 +525,12 @@ DataModelElement *depthBelowKeelNodeChildren[] = {
 };
 DataModelNode depthBelowKeelNode("belowKeel", &depthNode, depthBelowKeelNodeChildren);
 
-DataModelTenthsUInt16Leaf depthBelowSurfaceFeet("feet", &depthBelowSurfaceNode);
-DataModelTenthsUInt16Leaf depthBelowSurfaceMeters("meters", &depthBelowSurfaceNode);
-DataModelTenthsUInt16Leaf depthBelowSurfaceFathoms("fathoms", &depthBelowSurfaceNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf depthBelowSurfaceFeet("depth/belowSurface/feet",
+                                                           &depthBelowSurfaceNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf depthBelowSurfaceMeters("depth/belowSurface/meters",
+                                                             &depthBelowSurfaceNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf depthBelowSurfaceFathoms("depth/belowSurface/fathoms",
+                                                              &depthBelowSurfaceNode);
 
 DataModelElement *depthBelowSurfaceNodeChildren[] = {
     &depthBelowSurfaceFeet,
@@ -391,39 +540,358 @@ DataModelElement *depthBelowSurfaceNodeChildren[] = {
 };
 DataModelNode depthBelowSurfaceNode("belowSurface", &depthNode, depthBelowSurfaceNodeChildren);
 
+// DPT gives the depth below the transducer in meters along with the transducer offset, and is kept
+// apart from DBT's so a sounder sending both doesn't have them overwrite each other.
+FIXED_LEAF DataModelTenthsUInt16Leaf depthDPTBelowTransducer("depth/dpt/belowTransducer",
+                                                             &depthDPTNode);
+
+DataModelElement *depthDPTNodeChildren[] = {
+    &depthDPTBelowTransducer,
+    NULL,
+};
+DataModelNode depthDPTNode("dpt", &depthNode, depthDPTNodeChildren);
+
 DataModelElement *depthNodeChildren[] = {
     &depthBelowTransducerNode,
     &depthBelowKeelNode,
     &depthBelowSurfaceNode,
+    &depthDPTNode,
     NULL,
 };
 DataModelNode depthNode("depth", &dataModelRoot, depthNodeChildren);
 
+FIXED_LEAF DataModelTenthsInt16Leaf waterTemperature("water/temperature", &waterNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf waterSpeed("water/speed", &waterNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf waterSpeedKmPerH("water/speedKmPerH", &waterNode);
+
+DataModelElement *waterNodeChildren[] = {
+    &waterTemperature,
+    &waterSpeed,
+    &waterSpeedKmPerH,
+    NULL
+};
+DataModelNode waterNode("water", &dataModelRoot, waterNodeChildren);
+
+FIXED_LEAF DataModelTenthsUInt16Leaf headingTrue("heading/true", &headingNode);
+FIXED_LEAF DataModelTenthsUInt16Leaf headingMagnetic("heading/magnetic", &headingNode);
+
+DataModelElement *headingNodeChildren[] = {
+    &headingTrue,
+    &headingMagnetic,
+    NULL
+};
+DataModelNode headingNode("heading", &dataModelRoot, headingNodeChildren);
+
+static_assert(__COUNTER__ - fixedLeafCounterBase - 1 == dataModelFixedLeaves,
+              "dataModelFixedLeaves doesn't match the number of leaves defined with FIXED_LEAF");
+
+// Filled in by the AIS target table, which names each of its slots after the MMSI of the target it
+// currently holds.
+DataModelElement *aisNodeChildren[aisMaxTargets + 1];
+DataModelNode aisNode("ais", &dataModelRoot, aisNodeChildren);
+
 DataModelElement *topNodeChildren[] = {
     &sysNode,
     &gpsNode,
     &depthNode,
+    &waterNode,
+    &headingNode,
+    &aisNode,
     NULL
 };
 DataModelRoot dataModelRoot(topNodeChildren);
 
-DataModel::DataModel(StatsManager &statsManager) : root(dataModelRoot), leafUpdatesCounter() {
-    statsManager.addStatsHolder(this);
+DataModel::DataModel(StatsManager &statsManager)
+    : root(dataModelRoot), leafUpdatesCounter(), namedSlotFilters(), namedSlotLevelSeen(false) {
+    uint8_t slot;
+    for (slot = 0; slot < maxDataModelSubscribers; slot++) {
+        subscribers[slot] = NULL;
+        nextPendingLeaf[slot] = 0;
+    }
 
-    sysBrokerVersion = VERSION;
+    statsManager.addStatsHolder(this);
 }
 
-bool DataModel::subscribe(const char *topicFilter, DataModelSubscriber &subscriber,
-                          uint32_t cookie) {
-    return root.subscribe(topicFilter, subscriber, cookie);
+// A filter naming a slot's item is acknowledged even if no slot holds the item yet, as long as
+// it can be kept to bind later.
+bool DataModel::subscribe(const char *topicFilter, DataModelSubscriber &subscriber) {
+    namedSlotLevelSeen = false;
+    const bool subscribed = root.subscribe(topicFilter, subscriber);
+    if (!namedSlotLevelSeen) {
+        return subscribed;
+    }
+
+    if (addNamedSlotFilter(topicFilter, subscriber)) {
+        return true;
+    }
+
+    root.unsubscribe(topicFilter, subscriber);
+    return false;
 }
 
 void DataModel::unsubscribe(const char *topicFilter, DataModelSubscriber &subscriber) {
     root.unsubscribe(topicFilter, subscriber);
+
+    const uint8_t slot = subscriberSlot(subscriber);
+    if (slot != noSubscriberSlot) {
+        removeNamedSlotFilters(slot, topicFilter);
+    }
+}
+
+// Called by slot nodes as a subscription passes through them with a filter level that could name
+// their item.
+void DataModel::namedSlotLevel() {
+    namedSlotLevelSeen = true;
+}
+
+bool DataModel::addNamedSlotFilter(const char *topicFilter, DataModelSubscriber &subscriber) {
+    if (strlen(topicFilter) > maxNamedSlotFilterLength) {
+        LOG(logWarning) << "Topic Filter '" << topicFilter
+                        << "' naming a table slot is too long to keep" << eol;
+        return false;
+    }
+
+    const uint8_t slot = allocateSubscriberSlot(subscriber);
+    if (slot == noSubscriberSlot) {
+        return false;
+    }
+
+    for (const NamedSlotFilter &namedSlotFilter : namedSlotFilters) {
+        if (namedSlotFilter.subscriberSlot == slot &&
+            namedSlotFilter.topicFilter.compare(topicFilter) == 0) {
+            return true;
+        }
+    }
+
+    if (namedSlotFilters.full()) {
+        LOG(logWarning) << "No room to keep Topic Filter '" << topicFilter << "' for Client '"
+                        << subscriber.name() << "'" << eol;
+        return false;
+    }
+
+    namedSlotFilters.push_back(NamedSlotFilter());
+    namedSlotFilters.back().subscriberSlot = slot;
+    namedSlotFilters.back().topicFilter = topicFilter;
+
+    return true;
+}
+
+// Removes the subscriber's filters matching the given one, or all of them if it's NULL.
+void DataModel::removeNamedSlotFilters(uint8_t subscriberSlot, const char *topicFilter) {
+    auto iterator = namedSlotFilters.begin();
+    while (iterator != namedSlotFilters.end()) {
+        if (iterator->subscriberSlot == subscriberSlot &&
+            (topicFilter == NULL || iterator->topicFilter.compare(topicFilter) == 0)) {
+            iterator = namedSlotFilters.erase(iterator);
+        } else {
+            iterator++;
+        }
+    }
+}
+
+// Subscribes the kept filters that name the slot's new item, given the slot's topic name.
+void DataModel::bindNamedSlotFilters(DataModelSlotNode &node, const char *slotTopicName) {
+    for (const NamedSlotFilter &namedSlotFilter : namedSlotFilters) {
+        const char *slotLevel = slotFilterLevel(namedSlotFilter.topicFilter.c_str(),
+                                                slotTopicName);
+        if (slotLevel) {
+            node.subscribeIfMatching(slotLevel, *subscribers[namedSlotFilter.subscriberSlot]);
+        }
+    }
+}
+
+// Returns the part of the topic filter from the slot's level on, if the levels before it match
+// those of the slot's parents, or NULL if they don't.
+const char *DataModel::slotFilterLevel(const char *topicFilter, const char *slotTopicName) {
+    const char *lastSeparator = strrchr(slotTopicName, dataModelLevelSeparator);
+    if (lastSeparator == NULL) {
+        return topicFilter;
+    }
+
+    const char *topicLevel = slotTopicName;
+    while (topicLevel <= lastSeparator) {
+        const size_t levelLength = strchr(topicLevel, dataModelLevelSeparator) - topicLevel;
+        if (topicFilter[0] == dataModelSingleLevelWildcard &&
+            topicFilter[1] == dataModelLevelSeparator) {
+            topicFilter += 2;
+        } else if (strncmp(topicFilter, topicLevel, levelLength) == 0 &&
+                   topicFilter[levelLength] == dataModelLevelSeparator) {
+            topicFilter += levelLength + 1;
+        } else {
+            return NULL;
+        }
+        topicLevel += levelLength + 1;
+    }
+
+    return topicFilter;
 }
 
 void DataModel::unsubscribeAll(DataModelSubscriber &subscriber) {
-    root.unsubscribeAll(subscriber);
+    const uint8_t slot = subscriberSlot(subscriber);
+    if (slot == noSubscriberSlot) {
+        return;
+    }
+
+    DataModelLeafSet &leaves = subscribedLeaves[slot];
+    uint16_t leafIndex;
+    for (leafIndex = leaves.next(0); leafIndex < maxDataModelLeaves;
+         leafIndex = leaves.next(leafIndex + 1)) {
+        DataModelLeaf *leaf = DataModelLeaf::leafByIndex(leafIndex);
+        leaf->subscriberSlots &= ~(1 << slot);
+        leaf->wildcardSubscriberSlots &= ~(1 << slot);
+        sysBrokerSubscriptionsCount--;
+    }
+    leaves.clear();
+    pendingLeaves[slot].clear();
+    removeNamedSlotFilters(slot, NULL);
+    nextPendingLeaf[slot] = 0;
+    subscribers[slot] = NULL;
+
+    LOG(logDebugDataModel) << "Client '" << subscriber.name() << "' unsubscribed from all topics"
+                           << eol;
+}
+
+// Subscribing again to a leaf that's already subscribed to succeeds, so that retained values are
+// sent again as MQTT requires.
+bool DataModel::addSubscription(DataModelLeaf &leaf, DataModelSubscriber &subscriber) {
+    const uint8_t slot = allocateSubscriberSlot(subscriber);
+    if (slot == noSubscriberSlot) {
+        return false;
+    }
+
+    if (!subscribedLeaves[slot].contains(leaf.leafIndex())) {
+        subscribedLeaves[slot].add(leaf.leafIndex());
+        leaf.subscriberSlots |= 1 << slot;
+        sysBrokerSubscriptionsCount++;
+    }
+
+    return true;
+}
+
+bool DataModel::removeSubscription(DataModelLeaf &leaf, DataModelSubscriber &subscriber) {
+    const uint8_t slot = subscriberSlot(subscriber);
+    if (slot == noSubscriberSlot || !subscribedLeaves[slot].contains(leaf.leafIndex())) {
+        return false;
+    }
+
+    subscribedLeaves[slot].remove(leaf.leafIndex());
+    pendingLeaves[slot].remove(leaf.leafIndex());
+    leaf.subscriberSlots &= ~(1 << slot);
+    leaf.wildcardSubscriberSlots &= ~(1 << slot);
+    sysBrokerSubscriptionsCount--;
+
+    return true;
+}
+
+void DataModel::markWildcardSubscription(DataModelLeaf &leaf, DataModelSubscriber &subscriber) {
+    const uint8_t slot = subscriberSlot(subscriber);
+    if (slot != noSubscriberSlot) {
+        leaf.wildcardSubscriberSlots |= 1 << slot;
+    }
+}
+
+// Drops the leaf's subscriptions that didn't come through a wildcard, for when the slot node it's
+// under is given to a new item and they would otherwise follow the slot rather than the item.
+void DataModel::dropNamedSubscriptions(DataModelLeaf &leaf) {
+    const uint8_t namedSlots = leaf.subscriberSlots & ~leaf.wildcardSubscriberSlots;
+    uint8_t slot;
+    for (slot = 0; slot < maxDataModelSubscribers; slot++) {
+        if (namedSlots & (1 << slot)) {
+            removeSubscription(leaf, *subscribers[slot]);
+        }
+    }
+}
+
+DataModelSubscriber &DataModel::subscriberInSlot(uint8_t slot) const {
+    return *subscribers[slot];
+}
+
+void DataModel::markPending(DataModelLeaf &leaf) {
+    uint8_t slot;
+    for (slot = 0; slot < maxDataModelSubscribers; slot++) {
+        if (leaf.subscriberSlots & (1 << slot)) {
+            pendingLeaves[slot].add(leaf.leafIndex());
+        }
+    }
+}
+
+// Publishes the leaf straight away to those subscribers it's pending for, for when its topic is
+// about to change and it can't wait its turn.
+void DataModel::publishPendingLeaf(DataModelLeaf &leaf) {
+    uint8_t slot;
+    for (slot = 0; slot < maxDataModelSubscribers; slot++) {
+        if (pendingLeaves[slot].contains(leaf.leafIndex())) {
+            pendingLeaves[slot].remove(leaf.leafIndex());
+            leaf.publishLatestValue(*subscribers[slot]);
+        }
+    }
+}
+
+// Publishes the latest value of the subscriber's pending leaves until there are none left or the
+// time runs out, returning false in the latter case. Each call picks up where the last one left
+// off, so that the leaves late in the set get their turn when there's more pending than there is
+// time for.
+bool DataModel::publishPending(DataModelSubscriber &subscriber, uint32_t startMicroseconds,
+                               uint32_t maxMicroseconds) {
+    const uint8_t slot = subscriberSlot(subscriber);
+    if (slot == noSubscriberSlot) {
+        return true;
+    }
+
+    DataModelLeafSet &leaves = pendingLeaves[slot];
+    uint16_t leafIndex = leaves.next(nextPendingLeaf[slot]);
+    if (leafIndex == maxDataModelLeaves) {
+        leafIndex = leaves.next(0);
+    }
+    while (leafIndex < maxDataModelLeaves) {
+        leaves.remove(leafIndex);
+        DataModelLeaf::leafByIndex(leafIndex)->publishLatestValue(subscriber);
+
+        leafIndex = leaves.next(leafIndex + 1);
+        if (leafIndex == maxDataModelLeaves) {
+            leafIndex = leaves.next(0);
+        }
+
+        if (leafIndex < maxDataModelLeaves &&
+            micros() - startMicroseconds >= maxMicroseconds) {
+            nextPendingLeaf[slot] = leafIndex;
+            return false;
+        }
+    }
+
+    nextPendingLeaf[slot] = 0;
+    return true;
+}
+
+uint8_t DataModel::subscriberSlot(DataModelSubscriber &subscriber) const {
+    uint8_t slot;
+    for (slot = 0; slot < maxDataModelSubscribers; slot++) {
+        if (subscribers[slot] == &subscriber) {
+            return slot;
+        }
+    }
+
+    return noSubscriberSlot;
+}
+
+uint8_t DataModel::allocateSubscriberSlot(DataModelSubscriber &subscriber) {
+    const uint8_t slot = subscriberSlot(subscriber);
+    if (slot != noSubscriberSlot) {
+        return slot;
+    }
+
+    uint8_t freeSlot;
+    for (freeSlot = 0; freeSlot < maxDataModelSubscribers; freeSlot++) {
+        if (subscribers[freeSlot] == NULL) {
+            subscribers[freeSlot] = &subscriber;
+            return freeSlot;
+        }
+    }
+
+    // This shouldn't happen if max sessions == max subscribers
+    LOG(logError) << "No Data Model subscriber slot free for Client '" << subscriber.name() << "'"
+                  << eol;
+    return noSubscriberSlot;
 }
 
 void DataModel::leafUpdated() {
@@ -434,4 +902,5 @@ void DataModel::exportStats(uint32_t msElapsed) {
     leafUpdatesCounter.update(sysDataModelLeafUpdates, sysDataModelLeafUpdateRate, msElapsed);
 
     sysBrokerMessagesRetainedCount = DataModelRetainedValueLeaf::retainedValueCount();
+    sysDataModelLeaves = DataModelLeaf::leafCount();
 }
@@ -20,6 +20,7 @@
 #define DATA_MODEL_H
 
 class DataModelSubscriber;
+class DataModelSlotNode;
 class StatsManager;
 
 #include "DataModelNode.h"
@@ -32,15 +33,21 @@ class StatsManager;
 #include "DataModelHundredthsUInt8Leaf.h"
 #include "DataModelHundredthsUInt16Leaf.h"
 #include "DataModelStringLeaf.h"
+#include "DataModelLeafSet.h"
 
 #include "MQTT/MQTTSession.h"
 
 #include "StatsManager/StatCounter.h"
 #include "StatsManager/StatsHolder.h"
+#include "StatsManager/LoopProfiler.h"
 
 #include "Util/IPAddressTools.h"
 
+#include <etl/string.h>
+#include <etl/vector.h>
+
 #include <stdint.h>
+#include <stddef.h>
 
 const size_t maxTCPPortTextLength = 5;
 const size_t maxConnectionDescriptionLength =
@@ -51,6 +58,9 @@ const size_t maxSessionDescriptionLength =
 
 const size_t maxVersionLength = 20;
 
+// Counts of NMEA sentences dropped by a source's filter, as a list of type:count pairs.
+const size_t maxNMEAFilteredLength = 160;
+
 extern DataModelStringLeaf *sysBrokerConnectionDebugs[];
 extern DataModelNode sysBrokerConnectionsNode;
 
@@ -69,6 +79,7 @@ extern DataModelNode sysBrokerMessagesRetainedNode;
 extern DataModelUInt32Leaf sysBrokerMessagesPublishReceived;
 extern DataModelUInt32Leaf sysBrokerMessagesPublishSent;
 extern DataModelUInt32Leaf sysBrokerMessagesPublishDropped;
+extern DataModelUInt32Leaf sysBrokerPublishBudgetExhaustions;
 extern DataModelNode sysBrokerMessagesPublishNode;
 
 extern DataModelUInt32Leaf sysBrokerMessagesReceived;
@@ -85,33 +96,65 @@ extern DataModelNode sysBrokerNode;
 extern DataModelBoolLeaf sysNEMAWiFiState;
 extern DataModelLeaf sysNMEAWiFiMessages;
 extern DataModelLeaf sysNMEAWiFiMessageRate;
+extern DataModelLeaf sysNMEAWiFiBacklog;
+extern DataModelLeaf sysNMEAWiFiBudgetExhaustions;
+extern DataModelLeaf sysNMEAWiFiOverlengthLines;
+extern DataModelStringLeaf sysNMEAWiFiFiltered;
+extern DataModelLeaf sysNMEAWiFiDuplicates;
 extern DataModelNode sysNMEAWiFiNode;
 
 extern DataModelLeaf sysNMEAUSBMessages;
 extern DataModelLeaf sysNMEAUSBMessageRate;
+extern DataModelLeaf sysNMEAUSBBacklog;
+extern DataModelLeaf sysNMEAUSBBudgetExhaustions;
+extern DataModelLeaf sysNMEAUSBOverlengthLines;
+extern DataModelStringLeaf sysNMEAUSBFiltered;
+extern DataModelLeaf sysNMEAUSBDuplicates;
 extern DataModelNode sysNMEAUSBNode;
 
 extern DataModelNode sysNMEANode;
 
 extern DataModelLeaf sysDataModelLeafUpdates;
 extern DataModelLeaf sysDataModelLeafUpdateRate;
+extern DataModelUInt16Leaf sysDataModelLeaves;
 extern DataModelNode sysDataModelNode;
 
+extern DataModelLeaf sysAISMessages;
+extern DataModelLeaf sysAISMessageRate;
+extern DataModelLeaf sysAISUnsupported;
+extern DataModelLeaf sysAISBadMessages;
+extern DataModelLeaf sysAISFragmentsDropped;
+extern DataModelLeaf sysAISTargets;
+extern DataModelLeaf sysAISTargetsEvicted;
+extern DataModelNode sysAISNode;
+
 extern DataModelLeaf sysNMEADataModelMessagesBridged;
 extern DataModelLeaf sysNMEADataModelMessageBridgeRate;
+extern DataModelLeaf sysNMEADataModelEpochs;
+extern DataModelLeaf sysNMEADataModelEpochTimeouts;
+extern DataModelLeaf sysNMEADataModelSatellitesDropped;
 extern DataModelNode sysNMEADataModelBridgeNode;
 
 const size_t maxLogEntryLength = 80;
 const unsigned logEntrySlots = 5;
 extern DataModelStringLeaf *sysLogEntries[];
+extern DataModelUInt32Leaf sysLogDroppedLines;
 extern DataModelNode sysLogNode;
 
+#if LOOP_PROFILING
+// Filled in by the LoopProfiler with a node per stage, the whole loop and the worst case.
+extern DataModelElement *sysLoopNodeChildren[LOOP_STAGE_COUNT + 3];
+extern DataModelNode sysLoopNode;
+#endif
+
 extern DataModelNode sysNode;
 
 constexpr size_t timeLength = 15;
 extern DataModelStringLeaf gpsTime;
 constexpr size_t dateLength = 10;
 extern DataModelStringLeaf gpsDate;
+constexpr size_t timestampLength = 20;
+extern DataModelStringLeaf gpsTimestamp;
 extern DataModelBoolLeaf gpsDataValid;
 constexpr size_t coordinateLength = 20;
 extern DataModelStringLeaf gpsLatitude;
@@ -131,7 +174,7 @@ extern DataModelTenthsUInt16Leaf gpsDataAge;
 extern DataModelUInt16Leaf gpsDifferentialReferenceStation;
 extern DataModelStringLeaf gpsSatelliteSelectionMode;
 extern DataModelStringLeaf gpsFixMode;
-constexpr size_t activeSatellitesLength = 72;
+constexpr size_t activeSatellitesLength = 96;
 extern DataModelStringLeaf gpsActiveSatellites;
 extern DataModelHundredthsUInt8Leaf gpsPDOP;
 extern DataModelHundredthsUInt8Leaf gpsHDOP;
@@ -143,6 +186,15 @@ extern DataModelTenthsUInt16Leaf gpsOrientationOfSemiMajorAxis;
 extern DataModelTenthsUInt16Leaf gpsStandardDeviationOfLatitudeError;
 extern DataModelTenthsUInt16Leaf gpsStandardDeviationOfLongitudeError;
 extern DataModelTenthsUInt16Leaf gpsStandardDeviationOfAltitudeError;
+extern DataModelElement *gpsSatellitesGPSNodeChildren[];
+extern DataModelNode gpsSatellitesGPSNode;
+extern DataModelElement *gpsSatellitesGLONASSNodeChildren[];
+extern DataModelNode gpsSatellitesGLONASSNode;
+extern DataModelElement *gpsSatellitesGalileoNodeChildren[];
+extern DataModelNode gpsSatellitesGalileoNode;
+extern DataModelElement *gpsSatellitesBeiDouNodeChildren[];
+extern DataModelNode gpsSatellitesBeiDouNode;
+extern DataModelNode gpsSatellitesNode;
 extern DataModelNode gpsNode;
 
 extern DataModelTenthsUInt16Leaf depthBelowTransducerFeet;
@@ -160,8 +212,23 @@ extern DataModelTenthsUInt16Leaf depthBelowSurfaceMeters;
 extern DataModelTenthsUInt16Leaf depthBelowSurfaceFathoms;
 extern DataModelNode depthBelowSurfaceNode;
 
+extern DataModelTenthsUInt16Leaf depthDPTBelowTransducer;
+extern DataModelNode depthDPTNode;
+
 extern DataModelNode depthNode;
 
+extern DataModelTenthsInt16Leaf waterTemperature;
+extern DataModelTenthsUInt16Leaf waterSpeed;
+extern DataModelTenthsUInt16Leaf waterSpeedKmPerH;
+extern DataModelNode waterNode;
+
+extern DataModelTenthsUInt16Leaf headingTrue;
+extern DataModelTenthsUInt16Leaf headingMagnetic;
+extern DataModelNode headingNode;
+
+extern DataModelElement *aisNodeChildren[];
+extern DataModelNode aisNode;
+
 extern DataModelRoot dataModelRoot;
 
 const unsigned maxDataModelClients = 2;
@@ -174,25 +241,60 @@ const char dataModelLevelSeparator = '/';
 const char dataModelMultiLevelWildcard = '#';
 const char dataModelSingleLevelWildcard = '+';
 
+// Each subscriber is given a slot when it first subscribes, holding the set of leaves it's
+// subscribed to, while each leaf has a mask of the slots to publish to. Unsubscribing from
+// everything only has to visit the leaves in the subscriber's set, and the slot is then freed.
+//
+// A change to a retained value leaf isn't published as it happens, as that would have the NMEA
+// input waiting on writes to MQTT clients. Instead the leaf is added to a set of pending leaves for
+// each of its subscribers, and the broker later publishes the latest value of each pending leaf,
+// however many times it changed in the meantime.
+//
+// Topic filters that name a table slot's item, such as ais/366123456/#, are kept so that they can
+// be bound to the slot whenever it's given that item, whether or not it's held at the time of the
+// subscribe. There's room for a handful of them, and ones that can't be kept are refused.
 class DataModel : public StatsHolder {
     private:
+        static const uint8_t noSubscriberSlot = 0xff;
+        static const size_t maxNamedSlotFilters = 8;
+        static const size_t maxNamedSlotFilterLength = 40;
+
+        struct NamedSlotFilter {
+            uint8_t subscriberSlot;
+            etl::string<maxNamedSlotFilterLength> topicFilter;
+        };
+
         DataModelRoot &root;
         StatCounter leafUpdatesCounter;
+        DataModelSubscriber *subscribers[maxDataModelSubscribers];
+        DataModelLeafSet subscribedLeaves[maxDataModelSubscribers];
+        DataModelLeafSet pendingLeaves[maxDataModelSubscribers];
+        uint16_t nextPendingLeaf[maxDataModelSubscribers];
+        etl::vector<NamedSlotFilter, maxNamedSlotFilters> namedSlotFilters;
+        bool namedSlotLevelSeen;
+
+        bool addNamedSlotFilter(const char *topicFilter, DataModelSubscriber &subscriber);
+        void removeNamedSlotFilters(uint8_t subscriberSlot, const char *topicFilter);
+        static const char *slotFilterLevel(const char *topicFilter, const char *slotTopicName);
+        uint8_t subscriberSlot(DataModelSubscriber &subscriber) const;
+        uint8_t allocateSubscriberSlot(DataModelSubscriber &subscriber);
 
     public:
         DataModel(StatsManager &statsManager);
-        bool subscribe(const char *topicFilter, DataModelSubscriber &subscriber, uint32_t cookie);
+        bool subscribe(const char *topicFilter, DataModelSubscriber &subscriber);
         void unsubscribe(const char *topicFilter, DataModelSubscriber &subscriber);
-        // This method made need revisiting in the future. Currently we don't store references to
-        // what topics an MQTT Session is subscribed to, and the only way we can unsubscribe from
-        // all of its topics is to search the tree, finding and removing its subscriptions. Since
-        // we are running in an Arduino-esq, proto-threaded environment, this could lead to serial
-        // overruns if the tree grew dramatically in complexity. The alternative is to cache
-        // subscribed to topics at a Session level, but this is problematic because of the potential
-        // number of topics a client may be interested in and the limited dynamic memory of the
-        // Arduino syystems we target. At some poiint this should be metered to see how bad it is.
-        // Fortunately, NMEA 0183 is limited to fairly low bandwidths...
         void unsubscribeAll(DataModelSubscriber &subscriber);
+        bool addSubscription(DataModelLeaf &leaf, DataModelSubscriber &subscriber);
+        bool removeSubscription(DataModelLeaf &leaf, DataModelSubscriber &subscriber);
+        void markWildcardSubscription(DataModelLeaf &leaf, DataModelSubscriber &subscriber);
+        void dropNamedSubscriptions(DataModelLeaf &leaf);
+        void namedSlotLevel();
+        void bindNamedSlotFilters(DataModelSlotNode &node, const char *slotTopicName);
+        DataModelSubscriber &subscriberInSlot(uint8_t slot) const;
+        void markPending(DataModelLeaf &leaf);
+        void publishPendingLeaf(DataModelLeaf &leaf);
+        bool publishPending(DataModelSubscriber &subscriber, uint32_t startMicroseconds,
+                            uint32_t maxMicroseconds);
         void leafUpdated();
         virtual void exportStats(uint32_t msElapsed) override;
 };
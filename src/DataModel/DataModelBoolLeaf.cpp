@@ -19,9 +19,6 @@
 #include "DataModelBoolLeaf.h"
 #include "DataModelLeaf.h"
 
-#include <etl/string.h>
-#include <etl/to_string.h>
-
 #include <stdint.h>
 
 DataModelBoolLeaf::DataModelBoolLeaf(const char *name, DataModelElement *parent)
@@ -32,11 +29,6 @@ DataModelBoolLeaf & DataModelBoolLeaf::operator = (const bool value) {
     if (!hasValue() || this->value != value) {
         this->value = value;
         updated();
-        if (value) {
-            *this << (uint32_t)1;
-        } else {
-            *this << (uint32_t)0;
-        }
     }
 
     return *this;
@@ -47,14 +39,10 @@ DataModelBoolLeaf::operator bool() const {
 }
 
 
-void DataModelBoolLeaf::sendRetainedValue(DataModelSubscriber &subscriber) {
-    if (hasValue()) {
-        etl::string<2> valueStr;
-        if (value) {
-            valueStr = "1";
-        } else {
-            valueStr = "0";
-        }
-        publishToSubscriber(subscriber, valueStr, true);
+const char *DataModelBoolLeaf::formattedValue() {
+    if (value) {
+        return "1";
+    } else {
+        return "0";
     }
 }
@@ -24,14 +24,16 @@
 #include <stdint.h>
 
 class DataModelBoolLeaf : public DataModelRetainedValueLeaf {
-   private:
+    private:
         bool value;
 
+    protected:
+        virtual const char *formattedValue() override;
+
     public:
         DataModelBoolLeaf(const char *name, DataModelElement *parent);
         DataModelBoolLeaf & operator = (const bool value);
         operator bool() const;
-        virtual void sendRetainedValue(DataModelSubscriber &subscriber) override;
 };
 
 #endif // DATA_MODEL_BOOL_LEAF_H
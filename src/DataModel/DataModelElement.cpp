@@ -46,9 +46,9 @@ bool DataModelElement::topicFilterMatch(const char *topicFilter, unsigned &offse
                 return true;
 
             default:
-                logger << logError
-                       << "Data Model TopicFilter was not properly checked and went through invalid"
-                       << eol;
+                LOG(logError)
+                    << "Data Model TopicFilter was not properly checked and went through invalid"
+                    << eol;
                 return false;
         }
     } else {
@@ -60,6 +60,11 @@ bool DataModelElement::topicFilterMatch(const char *topicFilter, unsigned &offse
                 return false;
             }
         }
+        // The filter level has to be the whole of the name, not just the start of it, or a level
+        // such as "1" would match the satellite node "11".
+        if (name[pos] != 0) {
+            return false;
+        }
 
         offsetToNextLevel = pos + 1;
         lastLevel = topicFilter[pos] == 0;
@@ -69,7 +74,7 @@ bool DataModelElement::topicFilterMatch(const char *topicFilter, unsigned &offse
 }
 
 void DataModelElement::buildTopicName(char *topicNameBuffer) {
-    // TODO: Make this more efficent!
+    // Only used for leaves that don't have a fixed topic name, such as those of AIS targets.
     if (parent) {
         parent->buildTopicName(topicNameBuffer);
         if (topicNameBuffer[0] != 0) {
@@ -88,3 +93,13 @@ void DataModelElement::buildTopicName(char *topicNameBuffer) {
 const char *DataModelElement::elementName() const {
     return name;
 }
+
+// Elements kept in arrays can only be default constructed, so they're given their name and parent
+// once the array exists.
+void DataModelElement::setName(const char *name) {
+    this->name = name;
+}
+
+void DataModelElement::setParent(DataModelElement *parent) {
+    this->parent = parent;
+}
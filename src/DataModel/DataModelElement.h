@@ -21,10 +21,40 @@
 
 class DataModelSubscriber;
 
+#include "StatsManager/LoopStage.h"
+
 #include <stdint.h>
+#include <stddef.h>
 
 const unsigned maxDataModelSubscribers = 5;
 
+// The slots of the AIS target table and of each constellation's satellites in view, each of which
+// has a node of its own with this many leaves. Each constellation also has its inView leaf.
+const size_t aisMaxTargets = 16;
+const unsigned aisTargetLeaves = 6;
+const unsigned gpsSatelliteConstellations = 4;
+const size_t gpsMaxSatellitesInView = 16;
+const unsigned gsvSatelliteLeaves = 3;
+// The loop profiler has a node of leaves for each stage and one for the whole loop.
+const unsigned loopStageProfileLeaves = 4;
+
+// Leaves defined in DataModel.cpp, which checks the count at compile time.
+const unsigned dataModelFixedLeaves = 107;
+
+// Leaves are numbered as they're constructed, giving dense indices for per leaf bitmaps and tables.
+// Each leaf costs a pointer in the leaf table and a bit in every subscriber's sets, so the limit is
+// the number actually built: the fixed leaves, those of the AIS target and satellite slots, and
+// the loop profiler's when it's compiled in. Building more than this is a fatal error at start up.
+#if LOOP_PROFILING
+const unsigned loopProfilerLeaves = (LOOP_STAGE_COUNT + 1) * loopStageProfileLeaves + 1;
+#else
+const unsigned loopProfilerLeaves = 0;
+#endif
+const unsigned maxDataModelLeaves =
+    dataModelFixedLeaves + aisMaxTargets * aisTargetLeaves +
+    gpsSatelliteConstellations * (gpsMaxSatellitesInView * gsvSatelliteLeaves + 1) +
+    loopProfilerLeaves;
+
 class DataModelElement {
     private:
         const char *name;
@@ -39,12 +69,14 @@ class DataModelElement {
     public:
         DataModelElement(const char *name, DataModelElement *parent);
         const char *elementName() const;
+        void setName(const char *name);
+        void setParent(DataModelElement *parent);
         // Returns true if one or more subscriptions were made
-        virtual bool subscribeIfMatching(const char *topicFilter, DataModelSubscriber &subscriber,
-                                         uint32_t cookie) = 0;
+        virtual bool subscribeIfMatching(const char *topicFilter,
+                                         DataModelSubscriber &subscriber) = 0;
         virtual void unsubscribeIfMatching(const char *topicFilter,
                                            DataModelSubscriber &subscriber) = 0;
-        virtual bool subscribeAll(DataModelSubscriber &subscriber, uint32_t cookie) = 0;
+        virtual bool subscribeAll(DataModelSubscriber &subscriber) = 0;
         virtual void unsubscribeAll(DataModelSubscriber &subscriber) = 0;
 };
 
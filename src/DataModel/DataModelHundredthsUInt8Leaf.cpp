@@ -17,37 +17,35 @@
  */
 
 #include "DataModelHundredthsUInt8Leaf.h"
-#include "DataModelLeaf.h"
+#include "DataModelRetainedValueLeaf.h"
 
-#include <etl/string.h>
-#include <etl/string_stream.h>
+#include "Util/StringTools.h"
 
 #include <stdint.h>
 
-constexpr size_t maxStringLength = 6;
-
 DataModelHundredthsUInt8Leaf::DataModelHundredthsUInt8Leaf(const char *name,
                                                            DataModelElement *parent)
     : DataModelRetainedValueLeaf(name, parent) {
+    valueText[0] = 0;
 }
 
 void DataModelHundredthsUInt8Leaf::set(uint8_t wholeNumber, uint8_t hundredths) {
     if (!hasValue() || this->wholeNumber != wholeNumber || this->hundredths != hundredths) {
         this->wholeNumber = wholeNumber;
         this->hundredths = hundredths;
+        valueText[0] = 0;
         updated();
-        etl::string<maxStringLength> valueStr;
-        etl::string_stream valueStrStream(valueStr);
-        valueStrStream << wholeNumber << "." << etl::setfill(0) << etl::setw(2) << hundredths;
-        *this << valueStr;
     }
 }
 
-void DataModelHundredthsUInt8Leaf::sendRetainedValue(DataModelSubscriber &subscriber) {
-    if (hasValue()) {
-        etl::string<maxStringLength> valueStr;
-        etl::string_stream valueStrStream(valueStr);
-        valueStrStream << wholeNumber << "." << etl::setfill(0) << etl::setw(2) << hundredths;
-        publishToSubscriber(subscriber, valueStr, true);
+const char *DataModelHundredthsUInt8Leaf::formattedValue() {
+    if (valueText[0] == 0) {
+        char *fraction = formatUInt32(wholeNumber, valueText);
+        *fraction++ = '.';
+        if (hundredths < 10) {
+            *fraction++ = '0';
+        }
+        formatUInt32(hundredths, fraction);
     }
+    return valueText;
 }
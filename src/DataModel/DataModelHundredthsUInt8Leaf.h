@@ -16,22 +16,28 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef DATA_MODEL_HUNDREDTHS_UINT8_LEAF_H
-#define DATA_MODEL_HUNDREDTHS_UINT8_LEAF_H
+#ifndef DATA_MODEL_HUNDREDTHSUINT8_LEAF_H
+#define DATA_MODEL_HUNDREDTHSUINT8_LEAF_H
 
 #include "DataModelRetainedValueLeaf.h"
 
 #include <stdint.h>
+#include <stddef.h>
 
 class DataModelHundredthsUInt8Leaf : public DataModelRetainedValueLeaf {
-   private:
+    private:
+        static constexpr size_t maxValueTextLength = 7;
+
         uint8_t wholeNumber;
         uint8_t hundredths;
+        char valueText[maxValueTextLength + 1];
+
+    protected:
+        virtual const char *formattedValue() override;
 
     public:
         DataModelHundredthsUInt8Leaf(const char *name, DataModelElement *parent);
         void set(uint8_t wholeNumber, uint8_t hundredths);
-        virtual void sendRetainedValue(DataModelSubscriber &subscriber) override;
 };
 
 #endif
@@ -17,46 +17,37 @@
  */
 
 #include "DataModelInt8Leaf.h"
-#include "DataModelLeaf.h"
+#include "DataModelRetainedValueLeaf.h"
 
-#include <etl/string.h>
-#include <etl/to_string.h>
+#include "Util/StringTools.h"
 
 #include <stdint.h>
 
-constexpr size_t maxStringLength = 4;
-
 DataModelInt8Leaf::DataModelInt8Leaf(const char *name, DataModelElement *parent)
     : DataModelRetainedValueLeaf(name, parent) {
+    valueText[0] = 0;
 }
 
 DataModelInt8Leaf & DataModelInt8Leaf::operator = (const int8_t value) {
     if (!hasValue() || this->value != value) {
         this->value = value;
+        valueText[0] = 0;
         updated();
-        etl::string<maxStringLength> valueStr;
-        etl::to_string(value, valueStr);
-        *this << valueStr;
     }
-
     return *this;
 }
 
 DataModelInt8Leaf DataModelInt8Leaf::operator ++ (int) {
     value++;
+    valueText[0] = 0;
     updated();
-    etl::string<maxStringLength> valueStr;
-    etl::to_string(value, valueStr);
-    *this << valueStr;
     return *this;
 }
 
 DataModelInt8Leaf DataModelInt8Leaf::operator -- (int) {
     value--;
+    valueText[0] = 0;
     updated();
-    etl::string<maxStringLength> valueStr;
-    etl::to_string(value, valueStr);
-    *this << valueStr;
     return *this;
 }
 
@@ -64,10 +55,9 @@ DataModelInt8Leaf::operator int8_t() const {
     return value;
 }
 
-void DataModelInt8Leaf::sendRetainedValue(DataModelSubscriber &subscriber) {
-    if (hasValue()) {
-        etl::string<maxStringLength> valueStr;
-        etl::to_string(value, valueStr);
-        publishToSubscriber(subscriber, valueStr, true);
+const char *DataModelInt8Leaf::formattedValue() {
+    if (valueText[0] == 0) {
+        formatInt32(value, valueText);
     }
+    return valueText;
 }
@@ -22,10 +22,17 @@
 #include "DataModelRetainedValueLeaf.h"
 
 #include <stdint.h>
+#include <stddef.h>
 
 class DataModelInt8Leaf : public DataModelRetainedValueLeaf {
-   private:
+    private:
+        static constexpr size_t maxValueTextLength = 4;
+
         int8_t value;
+        char valueText[maxValueTextLength + 1];
+
+    protected:
+        virtual const char *formattedValue() override;
 
     public:
         DataModelInt8Leaf(const char *name, DataModelElement *parent);
@@ -33,7 +40,6 @@ class DataModelInt8Leaf : public DataModelRetainedValueLeaf {
         DataModelInt8Leaf operator ++ (int);
         DataModelInt8Leaf operator -- (int);
         operator int8_t() const;
-        virtual void sendRetainedValue(DataModelSubscriber &subscriber) override;
 };
 
 #endif
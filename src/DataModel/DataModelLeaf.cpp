@@ -20,101 +20,83 @@
 #include "DataModel.h"
 
 #include "Util/Logger.h"
+#include "Util/Error.h"
+#include "Util/StringTools.h"
 
 #include <etl/string.h>
-#include <etl/to_string.h>
 
 #include <stdint.h>
+#include <string.h>
+
+// Leaves are constructed during static initialization, in no particular order between files, so
+// the table relies only on being zero initialized.
+DataModelLeaf *DataModelLeaf::leaves[maxDataModelLeaves];
+uint16_t DataModelLeaf::leavesConstructed = 0;
 
 DataModelLeaf::DataModelLeaf(const char *name, DataModelElement *parent)
-    : DataModelElement(name, parent) {
-    unsigned subscriberPos;
-    for (subscriberPos = 0; subscriberPos < maxDataModelSubscribers; subscriberPos++) {
-        subscribers[subscriberPos] = NULL;
+    : DataModelElement(levelName(name), parent), topic(NULL), topicLength(0), subscriberSlots(0),
+      wildcardSubscriberSlots(0) {
+    if (levelName(name) != name) {
+        topic = name;
+        topicLength = strlen(name);
     }
-}
 
-bool DataModelLeaf::isSubscribed(DataModelSubscriber &subscriber) {
-    unsigned subscriberPos;
-    for (subscriberPos = 0; subscriberPos < maxDataModelSubscribers; subscriberPos++) {
-        if (subscribers[subscriberPos] == &subscriber) {
-            return true;
-        }
+    if (leavesConstructed == maxDataModelLeaves) {
+        fatalError("Attempt to construct more than the maximum number of Data Model leaves");
     }
-
-    return false;
+    index = leavesConstructed++;
+    leaves[index] = this;
 }
 
-bool DataModelLeaf::addSubscriber(DataModelSubscriber &subscriber, uint32_t cookie) {
-    unsigned subscriberPos;
-    for (subscriberPos = 0; subscriberPos < maxDataModelSubscribers; subscriberPos++) {
-        if (subscribers[subscriberPos] == NULL) {
-            subscribers[subscriberPos] = &subscriber;
-            cookies[subscriberPos] = cookie;
-
-            sysBrokerSubscriptionsCount++;
+uint16_t DataModelLeaf::leafIndex() const {
+    return index;
+}
 
-            return true;
-        }
-    }
+uint16_t DataModelLeaf::leafCount() {
+    return leavesConstructed;
+}
 
-    // This shouldn't happen if max sessions == max subscribers
-    return false;
+DataModelLeaf *DataModelLeaf::leafByIndex(uint16_t index) {
+    return leaves[index];
 }
 
-bool DataModelLeaf::updateSubscriber(DataModelSubscriber &subscriber, uint32_t cookie) {
-    unsigned subscriberPos;
-    for (subscriberPos = 0; subscriberPos < maxDataModelSubscribers; subscriberPos++) {
-        if (subscribers[subscriberPos] == &subscriber) {
-            cookies[subscriberPos] = cookie;
-            return true;
-        }
+// The element's own name is the last level of a full topic name.
+const char *DataModelLeaf::levelName(const char *name) {
+    const char *lastSeparator = strrchr(name, dataModelLevelSeparator);
+    if (lastSeparator) {
+        return lastSeparator + 1;
+    } else {
+        return name;
     }
+}
 
-    // This shouldn't happen if the call was used as expected. Error?
-    return false;
+bool DataModelLeaf::subscribe(DataModelSubscriber &subscriber) {
+    return dataModel.addSubscription(*this, subscriber);
 }
 
 void DataModelLeaf::unsubscribe(DataModelSubscriber &subscriber) {
-    unsigned subscriberPos;
-    for (subscriberPos = 0; subscriberPos < maxDataModelSubscribers; subscriberPos++) {
-        if (subscribers[subscriberPos] == &subscriber) {
-            subscribers[subscriberPos] = NULL;
-            sysBrokerSubscriptionsCount--;
-
-            // We don't cache the full name of a topic, and instead store it in bits in the tree,
-            // so we don't log the full name. If we switch to storing the name, this debug could be
-            // made to be more specific
-            logger << logDebugDataModel << "Client '" << subscriber.name()
-                   << "' unscribed from topic ending in '" << elementName() << "'" << eol;
-            return;
-        }
-    }
-
     // MQTT protocol wise, it's an acceptable occurance for a broker to receive an unsubscribe for
-    // a topic that it doesn't have an active subcription for. We didn't find the subscriber on the
-    // topic, but just calmly return.
-}
-
-bool DataModelLeaf::subscribe(DataModelSubscriber &subscriber, uint32_t cookie) {
-    if (isSubscribed(subscriber)) {
-        return updateSubscriber(subscriber, cookie);
-    } else {
-        return addSubscriber(subscriber, cookie);
+    // a topic that it doesn't have an active subcription for, so a subscriber that isn't found on
+    // the topic is calmly ignored.
+    if (dataModel.removeSubscription(*this, subscriber)) {
+        // Leaves under nodes named at run time don't keep their full topic name, so only the
+        // last level is logged.
+        LOG(logDebugDataModel) << "Client '" << subscriber.name()
+                               << "' unscribed from topic ending in '" << elementName() << "'"
+                               << eol;
     }
 }
 
-bool DataModelLeaf::subscribeIfMatching(const char *topicFilter, DataModelSubscriber &subscriber,
-                                        uint32_t cookie) {
+bool DataModelLeaf::subscribeIfMatching(const char *topicFilter, DataModelSubscriber &subscriber) {
     if (isMultiLevelWildcard(topicFilter)) {
-        return subscribe(subscriber, cookie);
+        return subscribe(subscriber);
     }
 
     unsigned offsetToNextLevel;
     bool lastLevel;
     if (topicFilterMatch(topicFilter, offsetToNextLevel, lastLevel)) {
         if (lastLevel) {
-            return subscribe(subscriber, cookie);
+            return subscribe(subscriber);
         } else {
             return false;
         }
@@ -123,42 +105,74 @@ bool DataModelLeaf::subscribeIfMatching(const char *topicFilter, DataModelSubscr
     }
 }
 
-bool DataModelLeaf::subscribeAll(DataModelSubscriber &subscriber, uint32_t cookie) {
-    logger << logDebugDataModel << subscriber.name() << " subscribing to element ending in '"
-           << elementName() << "' via subscription wildcard" << eol;
+bool DataModelLeaf::subscribeAll(DataModelSubscriber &subscriber) {
+    LOG(logDebugDataModel) << subscriber.name() << " subscribing to element ending in '"
+                           << elementName() << "' via subscription wildcard" << eol;
 
-    return subscribe(subscriber, cookie);
+    return subscribe(subscriber);
 }
 
 DataModelLeaf & DataModelLeaf::operator << (const etl::istring &value) {
-    unsigned subscriberIndex;
-    for (subscriberIndex = 0; subscriberIndex < maxDataModelSubscribers; subscriberIndex++) {
-        DataModelSubscriber *subscriber = subscribers[subscriberIndex];
-        if (subscriber != NULL) {
-            // This could be made more efficent by building a topic name outside of this loop
-            // instead of down in the publish routine...
-            publishToSubscriber(*subscriber, value, false);
-        }
-    }
-
-    dataModel.leafUpdated();
+    publish(value.c_str());
 
     return *this;
 }
 
 DataModelLeaf & DataModelLeaf::operator << (uint32_t value) {
-    etl::string<12> valueStr;
-    etl::to_string(value, valueStr);
-    *this << valueStr;
+    if (hasSubscribers()) {
+        char valueStr[12];
+        formatUInt32(value, valueStr);
+        publish(valueStr);
+    } else {
+        dataModel.leafUpdated();
+    }
 
     return *this;
 }
 
-void DataModelLeaf::publishToSubscriber(DataModelSubscriber &subscriber, const etl::istring &value,
+bool DataModelLeaf::hasSubscribers() const {
+    return subscriberSlots != 0;
+}
+
+// The one formatted value is handed to each of the leaf's subscribers in turn.
+void DataModelLeaf::publish(const char *value) {
+    if (subscriberSlots) {
+        char topicNameBuffer[maxTopicNameLength];
+        uint16_t leafTopicLength;
+        const char *leafTopic = topicName(topicNameBuffer, leafTopicLength);
+        uint8_t slot;
+        for (slot = 0; slot < maxDataModelSubscribers; slot++) {
+            if (subscriberSlots & (1 << slot)) {
+                dataModel.subscriberInSlot(slot).publish(leafTopic, leafTopicLength, value, false);
+            }
+        }
+    }
+
+    dataModel.leafUpdated();
+}
+
+// Leaves that don't retain a value publish it as it's written, so are never left pending.
+void DataModelLeaf::publishLatestValue(DataModelSubscriber &) {
+}
+
+void DataModelLeaf::publishToSubscriber(DataModelSubscriber &subscriber, const char *value,
                                         bool retainedValue) {
-    char topic[maxTopicNameLength];
-    buildTopicName(topic);
-    subscriber.publish(topic, value.c_str(), retainedValue);
+    char topicNameBuffer[maxTopicNameLength];
+    uint16_t leafTopicLength;
+    const char *leafTopic = topicName(topicNameBuffer, leafTopicLength);
+    subscriber.publish(leafTopic, leafTopicLength, value, retainedValue);
+}
+
+// Only leaves without a fixed topic name use the buffer.
+const char *DataModelLeaf::topicName(char *topicNameBuffer, uint16_t &length) {
+    if (topic) {
+        length = topicLength;
+        return topic;
+    }
+
+    buildTopicName(topicNameBuffer);
+    length = strlen(topicNameBuffer);
+    return topicNameBuffer;
 }
 
 void DataModelLeaf::unsubscribeIfMatching(const char *topicFilter,
@@ -27,28 +27,53 @@ class DataModelSubscriber;
 
 #include <stdint.h>
 
+// Leaves declared with a fixed place in the tree are given their full topic name, such as
+// "gps/latitude", rather than just their own level. The topic then stays in flash and is handed to
+// subscribers as is, with its length worked out once, so publishing does no string building. Leaves
+// under nodes that are named at run time, such as AIS targets, are given just their level and have
+// their topic name built once per update.
+//
+// Subscriptions are kept by the DataModel, in a set of leaves for each subscriber. The leaf only
+// holds a mask of the DataModel's subscriber slots that it's published to, and for leaves under
+// slot nodes, a mask of those that subscribed through a wildcard for the slot's level.
 class DataModelLeaf : public DataModelElement {
+    friend class DataModel;
+
     private:
-        DataModelSubscriber *subscribers[maxDataModelSubscribers];
-        uint32_t cookies[maxDataModelSubscribers];
-        bool addSubscriber(DataModelSubscriber &subscriber, uint32_t cookie);
+        const char *topic;
+        uint16_t topicLength;
+        uint16_t index;
+        uint8_t subscriberSlots;
+        uint8_t wildcardSubscriberSlots;
+        static_assert(maxDataModelSubscribers <= 8,
+                      "Data Model leaves have a mask of at most 8 subscriber slots");
+
+        static DataModelLeaf *leaves[maxDataModelLeaves];
+        static uint16_t leavesConstructed;
+
+        static const char *levelName(const char *name);
+        const char *topicName(char *topicNameBuffer, uint16_t &length);
 
     protected:
-        bool isSubscribed(DataModelSubscriber &subscriber);
-        bool updateSubscriber(DataModelSubscriber &subscriber, uint32_t cookie);
-        virtual bool subscribe(DataModelSubscriber &subscriber, uint32_t cookie);
+        virtual bool subscribe(DataModelSubscriber &subscriber);
         void unsubscribe(DataModelSubscriber &subscriber);
-        void publishToSubscriber(DataModelSubscriber &subscriber, const etl::istring &value,
+        bool hasSubscribers() const;
+        void publish(const char *value);
+        void publishToSubscriber(DataModelSubscriber &subscriber, const char *value,
                                  bool retainedValue);
 
     public:
         DataModelLeaf(const char *name, DataModelElement *parent);
-        virtual bool subscribeIfMatching(const char *topicFilter, DataModelSubscriber &subscriber,
-                                         uint32_t cookie) override;
-        virtual bool subscribeAll(DataModelSubscriber &subscriber, uint32_t cookie) override;
+        uint16_t leafIndex() const;
+        static uint16_t leafCount();
+        static DataModelLeaf *leafByIndex(uint16_t index);
+        virtual bool subscribeIfMatching(const char *topicFilter,
+                                         DataModelSubscriber &subscriber) override;
+        virtual bool subscribeAll(DataModelSubscriber &subscriber) override;
         virtual void unsubscribeIfMatching(const char *topicFilter,
                                            DataModelSubscriber &subscriber) override;
         virtual void unsubscribeAll(DataModelSubscriber &subscriber) override;
+        virtual void publishLatestValue(DataModelSubscriber &subscriber);
         DataModelLeaf & operator << (const etl::istring &value);
         DataModelLeaf & operator << (uint32_t value);
 };
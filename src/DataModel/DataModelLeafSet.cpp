@@ -0,0 +1,81 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DataModelLeafSet.h"
+#include "DataModelElement.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+DataModelLeafSet::DataModelLeafSet() {
+    clear();
+}
+
+void DataModelLeafSet::add(uint16_t leafIndex) {
+    bits[leafIndex / bitsPerWord] |= 1UL << (leafIndex % bitsPerWord);
+}
+
+void DataModelLeafSet::remove(uint16_t leafIndex) {
+    bits[leafIndex / bitsPerWord] &= ~(1UL << (leafIndex % bitsPerWord));
+}
+
+bool DataModelLeafSet::contains(uint16_t leafIndex) const {
+    return (bits[leafIndex / bitsPerWord] & (1UL << (leafIndex % bitsPerWord))) != 0;
+}
+
+bool DataModelLeafSet::isEmpty() const {
+    for (size_t word = 0; word < words; word++) {
+        if (bits[word]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DataModelLeafSet::clear() {
+    for (size_t word = 0; word < words; word++) {
+        bits[word] = 0;
+    }
+}
+
+// Empty words are skipped whole, so walking a sparse set is cheap.
+uint16_t DataModelLeafSet::next(uint16_t leafIndex) const {
+    size_t word = leafIndex / bitsPerWord;
+    if (word >= words) {
+        return maxDataModelLeaves;
+    }
+
+    uint32_t remaining = bits[word] >> (leafIndex % bitsPerWord);
+    while (true) {
+        if (remaining) {
+            while ((remaining & 1) == 0) {
+                remaining >>= 1;
+                leafIndex++;
+            }
+            return leafIndex;
+        }
+
+        word++;
+        if (word == words) {
+            return maxDataModelLeaves;
+        }
+        remaining = bits[word];
+        leafIndex = word * bitsPerWord;
+    }
+}
@@ -16,36 +16,32 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef NMEA_INT8_H
-#define NMEA_INT8_H
+#ifndef DATA_MODEL_LEAF_SET_H
+#define DATA_MODEL_LEAF_SET_H
 
-#include "NMEALine.h"
-#include "NMEATalker.h"
-
-#include "DataModel/DataModelInt8Leaf.h"
-
-#include "Util/LoggableItem.h"
-#include "Util/Logger.h"
-
-#include <etl/string_view.h>
+#include "DataModelElement.h"
 
 #include <stdint.h>
+#include <stddef.h>
 
-class NMEAInt8 : public LoggableItem {
+// A set of Data Model leaves, kept as a bitmap indexed by leaf number.
+class DataModelLeafSet {
     private:
-        int8_t value;
-        bool valuePresent;
+        static const size_t bitsPerWord = 32;
+        static const size_t words = (maxDataModelLeaves + bitsPerWord - 1) / bitsPerWord;
 
-        bool set(const etl::string_view &valueView, bool optional, int8_t minValue,
-                 int8_t maxValue);
+        uint32_t bits[words];
 
     public:
-        bool extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType,
-                     const char *fieldName, bool optional = false, int8_t minValue = -128,
-                     int8_t maxValue = 127);
-        bool hasValue() const;
-        void publish(DataModelInt8Leaf &leaf) const;
-        virtual void log(Logger &logger) const override;
+        DataModelLeafSet();
+        void add(uint16_t leafIndex);
+        void remove(uint16_t leafIndex);
+        bool contains(uint16_t leafIndex) const;
+        bool isEmpty() const;
+        void clear();
+        // Returns the lowest leaf index in the set that's at least the given one, or
+        // maxDataModelLeaves if there isn't one.
+        uint16_t next(uint16_t leafIndex) const;
 };
 
 #endif
@@ -28,15 +28,15 @@ DataModelNode::DataModelNode(const char *name, DataModelElement *parent,
     : DataModelElement(name, parent), children(children) {
 }
 
-bool DataModelNode::subscribeAll(DataModelSubscriber &subscriber, uint32_t cookie) {
-    logger << logDebugDataModel << subscriber.name()
-           << " subscribing to children of node ending in '" << elementName()
-           << "' via subscription wildcard" << eol;
+bool DataModelNode::subscribeAll(DataModelSubscriber &subscriber) {
+    LOG(logDebugDataModel) << subscriber.name()
+                           << " subscribing to children of node ending in '" << elementName()
+                           << "' via subscription wildcard" << eol;
 
     unsigned childIndex;
     for (childIndex = 0; children[childIndex] != nullptr; childIndex++) {
         DataModelElement *child = children[childIndex];
-        if (!child->subscribeAll(subscriber, cookie)) {
+        if (!child->subscribeAll(subscriber)) {
             return false;
         }
     }
@@ -44,10 +44,9 @@ bool DataModelNode::subscribeAll(DataModelSubscriber &subscriber, uint32_t cooki
     return true;
 }
 
-bool DataModelNode::subscribeIfMatching(const char *topicFilter, DataModelSubscriber &subscriber,
-                                        uint32_t cookie) {
+bool DataModelNode::subscribeIfMatching(const char *topicFilter, DataModelSubscriber &subscriber) {
     if (isMultiLevelWildcard(topicFilter)) {
-        return subscribeAll(subscriber, cookie);
+        return subscribeAll(subscriber);
     }
 
     unsigned offsetToNextLevel;
@@ -59,7 +58,7 @@ bool DataModelNode::subscribeIfMatching(const char *topicFilter, DataModelSubscr
             return false;
         } else {
             const char *newTopicFilter = topicFilter + offsetToNextLevel;
-            return subscribeChildrenIfMatching(newTopicFilter, subscriber, cookie);
+            return subscribeChildrenIfMatching(newTopicFilter, subscriber);
         }
     } else {
         return false;
@@ -67,13 +66,12 @@ bool DataModelNode::subscribeIfMatching(const char *topicFilter, DataModelSubscr
 }
 
 bool DataModelNode::subscribeChildrenIfMatching(const char *topicFilter,
-                                                DataModelSubscriber &subscriber,
-                                                uint32_t cookie) {
+                                                DataModelSubscriber &subscriber) {
     unsigned childIndex;
     bool atLeastOneMatch = false;
     for (childIndex = 0; children[childIndex] != nullptr; childIndex++) {
         DataModelElement *child = children[childIndex];
-        if (child->subscribeIfMatching(topicFilter, subscriber, cookie)) {
+        if (child->subscribeIfMatching(topicFilter, subscriber)) {
             atLeastOneMatch = true;
         }
     }
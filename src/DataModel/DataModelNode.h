@@ -30,18 +30,17 @@ class DataModelNode : public DataModelElement {
         // Pointer to a static, null terminated array of children.
         DataModelElement **children;
 
-        bool subscribeChildrenIfMatching(const char *topicFilter, DataModelSubscriber &subscriber,
-                                         uint32_t cookie);
+        bool subscribeChildrenIfMatching(const char *topicFilter, DataModelSubscriber &subscriber);
         void unsubscribeChildrenIfMatching(const char *topicFilter,
                                            DataModelSubscriber &subscriber);
 
     public:
         DataModelNode(const char *name, DataModelElement *parent, DataModelElement **children);
-        virtual bool subscribeIfMatching(const char *topicFilter, DataModelSubscriber &subscriber,
-                                         uint32_t cookie) override;
+        virtual bool subscribeIfMatching(const char *topicFilter,
+                                         DataModelSubscriber &subscriber) override;
         virtual void unsubscribeIfMatching(const char *topicFilter,
                                            DataModelSubscriber &subscriber) override;
-        virtual bool subscribeAll(DataModelSubscriber &subscriber, uint32_t cookie) override;
+        virtual bool subscribeAll(DataModelSubscriber &subscriber) override;
         virtual void unsubscribeAll(DataModelSubscriber &subscriber) override;
 };
 
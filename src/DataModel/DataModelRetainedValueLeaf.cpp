@@ -18,8 +18,7 @@
 
 #include "DataModelRetainedValueLeaf.h"
 #include "DataModelLeaf.h"
-
-#include <etl/string.h>
+#include "DataModel.h"
 
 #include <stdint.h>
 
@@ -33,8 +32,8 @@ DataModelRetainedValueLeaf::DataModelRetainedValueLeaf(const char *name, DataMod
     : DataModelLeaf(name, parent), hasBeenSet(false) {
 }
 
-bool DataModelRetainedValueLeaf::subscribe(DataModelSubscriber &subscriber, uint32_t cookie) {
-    if (!DataModelLeaf::subscribe(subscriber, cookie)) {
+bool DataModelRetainedValueLeaf::subscribe(DataModelSubscriber &subscriber) {
+    if (!DataModelLeaf::subscribe(subscriber)) {
         return false;
     }
 
@@ -43,19 +42,50 @@ bool DataModelRetainedValueLeaf::subscribe(DataModelSubscriber &subscriber, uint
     return true;
 }
 
+// Called once the new value has been stored and any formatted text of the old one dropped.
 void DataModelRetainedValueLeaf::updated() {
     if (!hasBeenSet) {
         retainedValues++;
         hasBeenSet = true;
     }
+
+    changed();
 }
 
 void DataModelRetainedValueLeaf::removeValue() {
     if (hasBeenSet) {
-        etl::string<1> emptyStr;
-
-        *this << emptyStr;
         hasBeenSet = false;
+        changed();
+    }
+}
+
+// Leaves under nodes that are renamed at run time have to have their value cleared under the old
+// name, so the removal is published before the node's name changes rather than left pending.
+void DataModelRetainedValueLeaf::removeValueNow() {
+    removeValue();
+    dataModel.publishPendingLeaf(*this);
+}
+
+void DataModelRetainedValueLeaf::changed() {
+    if (hasSubscribers()) {
+        dataModel.markPending(*this);
+    }
+
+    dataModel.leafUpdated();
+}
+
+// A leaf whose value has been removed publishes an empty value.
+void DataModelRetainedValueLeaf::publishLatestValue(DataModelSubscriber &subscriber) {
+    if (hasBeenSet) {
+        publishToSubscriber(subscriber, formattedValue(), false);
+    } else {
+        publishToSubscriber(subscriber, "", false);
+    }
+}
+
+void DataModelRetainedValueLeaf::sendRetainedValue(DataModelSubscriber &subscriber) {
+    if (hasBeenSet) {
+        publishToSubscriber(subscriber, formattedValue(), true);
     }
 }
 
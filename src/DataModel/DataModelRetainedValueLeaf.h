@@ -23,20 +23,29 @@
 
 #include <stdint.h>
 
+// Leaves that retain a value keep it in its binary form and only format it as text when there's
+// someone to publish it to. The text is kept until the value next changes, so that it's formatted
+// once for all of the leaf's subscribers and for those that later subscribe and are sent the
+// retained value. Changes are left pending with the DataModel and published later by the broker.
 class DataModelRetainedValueLeaf : public DataModelLeaf {
     private:
         bool hasBeenSet;
         static uint16_t retainedValues;
 
+        void sendRetainedValue(DataModelSubscriber &subscriber);
+        void changed();
+
     protected:
         DataModelRetainedValueLeaf(const char *name, DataModelElement *parent);
-        virtual bool subscribe(DataModelSubscriber &subscriber, uint32_t cookie) override;
+        virtual bool subscribe(DataModelSubscriber &subscriber) override;
         void updated();
         bool hasValue() const;
-        virtual void sendRetainedValue(DataModelSubscriber &subscriber) = 0;
+        virtual const char *formattedValue() = 0;
 
     public:
+        virtual void publishLatestValue(DataModelSubscriber &subscriber) override;
         void removeValue();
+        void removeValueNow();
         static uint16_t retainedValueCount();
 };
 
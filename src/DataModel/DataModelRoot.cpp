@@ -28,30 +28,30 @@
 DataModelRoot::DataModelRoot(DataModelElement **children) : DataModelNode(NULL, NULL, children) {
 }
 
-bool DataModelRoot::subscribe(const char *topicFilter, DataModelSubscriber &subscriber,
-                              uint32_t cookie) {
+bool DataModelRoot::subscribe(const char *topicFilter, DataModelSubscriber &subscriber) {
     if (!checkTopicFilterValidity(topicFilter )) {
-        logger << logWarning << "Illegal Topic Filter '" << topicFilter << "'" << eol;
+        LOG(logWarning) << "Illegal Topic Filter '" << topicFilter << "'" << eol;
         return false;
     }
 
     if (isMultiLevelWildcard(topicFilter)) {
-        logger << logDebugDataModel << subscriber.name() << " subscribing to all (#)" << eol;
-        return subscribeAll(subscriber, cookie);
+        LOG(logDebugDataModel) << subscriber.name() << " subscribing to all (#)" << eol;
+        return subscribeAll(subscriber);
     }
 
-    return subscribeChildrenIfMatching(topicFilter, subscriber, cookie);
+    return subscribeChildrenIfMatching(topicFilter, subscriber);
 }
 
-bool DataModelRoot::subscribeAll(DataModelSubscriber &subscriber, uint32_t cookie) {
-    logger << logDebugDataModel << subscriber.name()
-           << " subscribing to children of root node via multilevel wildcard" << eol;
+bool DataModelRoot::subscribeAll(DataModelSubscriber &subscriber) {
+    LOG(logDebugDataModel) << subscriber.name()
+                           << " subscribing to children of root node via multilevel wildcard"
+                           << eol;
 
     unsigned childIndex;
     for (childIndex = 0; children[childIndex] != nullptr; childIndex++) {
         DataModelElement *child = children[childIndex];
         if (child->elementName()[0] != '$') {
-            if (!child->subscribeAll(subscriber, cookie)) {
+            if (!child->subscribeAll(subscriber)) {
                 return false;
             }
         }
@@ -61,7 +61,7 @@ bool DataModelRoot::subscribeAll(DataModelSubscriber &subscriber, uint32_t cooki
 }
 
 bool DataModelRoot::subscribeChildrenIfMatching(const char *topicFilter,
-                                                DataModelSubscriber &subscriber, uint32_t cookie) {
+                                                DataModelSubscriber &subscriber) {
     const bool isSingleLevelWildcard = topicFilter[0] == dataModelSingleLevelWildcard;
 
     unsigned childIndex;
@@ -71,7 +71,7 @@ bool DataModelRoot::subscribeChildrenIfMatching(const char *topicFilter,
         // Per the MQTT specification, single level wildcards must not match with topics beginning
         // with a $
         if (!(isSingleLevelWildcard && child->elementName()[0] == '$')) {
-            if (child->subscribeIfMatching(topicFilter, subscriber, cookie)) {
+            if (child->subscribeIfMatching(topicFilter, subscriber)) {
                 atLeastOneMatch = true;
             }
         }
@@ -82,8 +82,8 @@ bool DataModelRoot::subscribeChildrenIfMatching(const char *topicFilter,
 
 void DataModelRoot::unsubscribe(const char *topicFilter, DataModelSubscriber &subscriber) {
     if (!checkTopicFilterValidity(topicFilter )) {
-        logger << logWarning << "Illegal Topic Filter '" << topicFilter
-               << "' in unsubscribe from Client '" << subscriber.name() << eol;
+        LOG(logWarning) << "Illegal Topic Filter '" << topicFilter
+                        << "' in unsubscribe from Client '" << subscriber.name() << eol;
         return;
     }
 
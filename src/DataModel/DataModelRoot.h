@@ -26,14 +26,13 @@
 class DataModelRoot : public DataModelNode {
     private:
         bool checkTopicFilterValidity(const char *topicFilter);
-        bool subscribeChildrenIfMatching(const char *topicFilter, DataModelSubscriber &subscriber,
-                                         uint32_t cookie);
+        bool subscribeChildrenIfMatching(const char *topicFilter, DataModelSubscriber &subscriber);
 
     public:
         DataModelRoot(DataModelElement **children);
-        bool subscribe(const char *topicFilter, DataModelSubscriber &subscriber, uint32_t cookie);
+        bool subscribe(const char *topicFilter, DataModelSubscriber &subscriber);
         void unsubscribe(const char *topicFilter, DataModelSubscriber &subscriber);
-        virtual bool subscribeAll(DataModelSubscriber &subscriber, uint32_t cookie) override;
+        virtual bool subscribeAll(DataModelSubscriber &subscriber) override;
 };
 
 #endif
@@ -0,0 +1,106 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "DataModelSlotNode.h"
+#include "DataModelNode.h"
+#include "DataModelElement.h"
+#include "DataModelLeaf.h"
+#include "DataModel.h"
+
+#include <stdint.h>
+
+DataModelSlotNode::DataModelSlotNode(const char *name, DataModelElement *parent,
+                                     DataModelElement **children)
+    : DataModelNode(name, parent, children) {
+}
+
+bool DataModelSlotNode::isSingleLevelWildcard(const char *topicFilter) {
+    return topicFilter[0] == dataModelSingleLevelWildcard &&
+           (topicFilter[1] == 0 || topicFilter[1] == dataModelLevelSeparator);
+}
+
+// Slots are named after numbers, so only filter levels made of digits can name a slot's item.
+bool DataModelSlotNode::isNumericLevel(const char *topicFilter) {
+    unsigned pos;
+    for (pos = 0; topicFilter[pos] != 0 && topicFilter[pos] != dataModelLevelSeparator; pos++) {
+        if (topicFilter[pos] < '0' || topicFilter[pos] > '9') {
+            return false;
+        }
+    }
+
+    return pos > 0;
+}
+
+bool DataModelSlotNode::subscribeIfMatching(const char *topicFilter,
+                                            DataModelSubscriber &subscriber) {
+    if (isMultiLevelWildcard(topicFilter)) {
+        return subscribeAll(subscriber);
+    }
+
+    if (!isSingleLevelWildcard(topicFilter)) {
+        if (isNumericLevel(topicFilter)) {
+            dataModel.namedSlotLevel();
+        }
+        return DataModelNode::subscribeIfMatching(topicFilter, subscriber);
+    }
+
+    unsigned offsetToNextLevel;
+    bool lastLevel;
+    if (!topicFilterMatch(topicFilter, offsetToNextLevel, lastLevel) || lastLevel) {
+        return false;
+    }
+
+    const char *newTopicFilter = topicFilter + offsetToNextLevel;
+    unsigned childIndex;
+    bool atLeastOneMatch = false;
+    for (childIndex = 0; children[childIndex] != nullptr; childIndex++) {
+        DataModelLeaf *leaf = static_cast<DataModelLeaf *>(children[childIndex]);
+        if (leaf->subscribeIfMatching(newTopicFilter, subscriber)) {
+            dataModel.markWildcardSubscription(*leaf, subscriber);
+            atLeastOneMatch = true;
+        }
+    }
+
+    return atLeastOneMatch;
+}
+
+bool DataModelSlotNode::subscribeAll(DataModelSubscriber &subscriber) {
+    unsigned childIndex;
+    for (childIndex = 0; children[childIndex] != nullptr; childIndex++) {
+        DataModelLeaf *leaf = static_cast<DataModelLeaf *>(children[childIndex]);
+        if (!leaf->subscribeAll(subscriber)) {
+            return false;
+        }
+        dataModel.markWildcardSubscription(*leaf, subscriber);
+    }
+
+    return true;
+}
+
+void DataModelSlotNode::dropNamedSubscriptions() {
+    unsigned childIndex;
+    for (childIndex = 0; children[childIndex] != nullptr; childIndex++) {
+        dataModel.dropNamedSubscriptions(*static_cast<DataModelLeaf *>(children[childIndex]));
+    }
+}
+
+// Called once the slot has been renamed after its new item.
+void DataModelSlotNode::bindNamedSubscriptions() {
+    char topicName[maxTopicNameLength];
+    buildTopicName(topicName);
+    dataModel.bindNamedSlotFilters(*this, topicName);
+}
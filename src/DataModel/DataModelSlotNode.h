@@ -0,0 +1,49 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef DATA_MODEL_SLOT_NODE_H
+#define DATA_MODEL_SLOT_NODE_H
+
+class DataModelSubscriber;
+
+#include "DataModelNode.h"
+#include "DataModelElement.h"
+
+#include <stdint.h>
+
+// A node for one slot of a table, such as the AIS targets, that's named at run time after the
+// number of the item the slot currently holds. Its children must all be leaves. Subscriptions that
+// reached the leaves through a wildcard at the slot's level carry over when the slot is given a new
+// item, while those that named the old item are dropped with dropNamedSubscriptions(). Filters
+// naming an item are kept by the DataModel, and bound with bindNamedSubscriptions() whenever a
+// slot is named after that item.
+class DataModelSlotNode : public DataModelNode {
+    private:
+        static bool isSingleLevelWildcard(const char *topicFilter);
+        static bool isNumericLevel(const char *topicFilter);
+
+    public:
+        DataModelSlotNode(const char *name, DataModelElement *parent,
+                          DataModelElement **children);
+        virtual bool subscribeIfMatching(const char *topicFilter,
+                                         DataModelSubscriber &subscriber) override;
+        virtual bool subscribeAll(DataModelSubscriber &subscriber) override;
+        void dropNamedSubscriptions();
+        void bindNamedSubscriptions();
+};
+
+#endif
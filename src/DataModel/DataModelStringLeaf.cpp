@@ -31,7 +31,6 @@ DataModelStringLeaf & DataModelStringLeaf::operator = (const etl::istring &newSt
     if (!hasValue() || value.compare(newString) != 0) {
         value = newString;
         updated();
-        *this << value;
     }
 
     return *this;
@@ -41,7 +40,6 @@ DataModelStringLeaf & DataModelStringLeaf::operator = (const char *newString) {
     if (!hasValue() || value.compare(newString) != 0) {
         value = newString;
         updated();
-        *this << value;
     }
 
     return *this;
@@ -51,7 +49,6 @@ DataModelStringLeaf & DataModelStringLeaf::operator = (const DataModelStringLeaf
     if (!hasValue() || value.compare(otherLeaf.value) != 0) {
         this->value = otherLeaf.value;
         updated();
-        *this << value;
     }
 
     return *this;
@@ -65,10 +62,9 @@ int DataModelStringLeaf::compare(const etl::istring &otherString) const {
     return value.compare(otherString);
 }
 
-void DataModelStringLeaf::sendRetainedValue(DataModelSubscriber &subscriber) {
-    if (hasValue()) {
-        publishToSubscriber(subscriber, value, true);
-    }
+// The value is already text, so it's handed to subscribers as is.
+const char *DataModelStringLeaf::formattedValue() {
+    return value.c_str();
 }
 
 bool DataModelStringLeaf::isEmptyStr() const {
@@ -29,6 +29,9 @@ class DataModelStringLeaf : public DataModelRetainedValueLeaf {
     private:
         etl::istring &value;
 
+    protected:
+        virtual const char *formattedValue() override;
+
     public:
         DataModelStringLeaf(const char *name, DataModelElement *parent, etl::istring &buffer);
         DataModelStringLeaf & operator = (const etl::istring &newString);
@@ -36,7 +39,6 @@ class DataModelStringLeaf : public DataModelRetainedValueLeaf {
         DataModelStringLeaf & operator = (const DataModelStringLeaf &otherLeaf);
         operator const char * () const;
         int compare(const etl::istring &otherString) const;
-        virtual void sendRetainedValue(DataModelSubscriber &subscriber) override;
         bool isEmptyStr() const;
         size_t maxLength() const;
 };
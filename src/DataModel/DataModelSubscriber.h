@@ -21,9 +21,12 @@
 
 #include <etl/string.h>
 
+#include <stdint.h>
+
 class DataModelSubscriber {
     public:
-        virtual void publish(const char *topic, const char *value, bool retainedValue) = 0;
+        virtual void publish(const char *topic, uint16_t topicLength, const char *value,
+                             bool retainedValue) = 0;
         virtual const etl::istring &name() const = 0;
 };
 
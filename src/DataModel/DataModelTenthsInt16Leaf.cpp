@@ -17,37 +17,35 @@
  */
 
 #include "DataModelTenthsInt16Leaf.h"
-#include "DataModelLeaf.h"
+#include "DataModelRetainedValueLeaf.h"
 
-#include <etl/string.h>
-#include <etl/string_stream.h>
+#include "Util/StringTools.h"
 
 #include <stdint.h>
-#include <stddef.h>
-
-constexpr size_t maxStringLength = 8;
 
 DataModelTenthsInt16Leaf::DataModelTenthsInt16Leaf(const char *name, DataModelElement *parent)
     : DataModelRetainedValueLeaf(name, parent) {
+    valueText[0] = 0;
 }
 
-void DataModelTenthsInt16Leaf::set(int16_t wholeNumber, uint8_t tenths) {
-    if (!hasValue() || this->wholeNumber != wholeNumber || this->tenths != tenths) {
-        this->wholeNumber = wholeNumber;
+void DataModelTenthsInt16Leaf::set(int32_t tenths) {
+    if (!hasValue() || this->tenths != tenths) {
         this->tenths = tenths;
+        valueText[0] = 0;
         updated();
-        etl::string<maxStringLength> valueStr;
-        etl::string_stream valueStrStream(valueStr);
-        valueStrStream << wholeNumber << "." << tenths;
-        *this << valueStr;
     }
 }
 
-void DataModelTenthsInt16Leaf::sendRetainedValue(DataModelSubscriber &subscriber) {
-    if (hasValue()) {
-        etl::string<maxStringLength> valueStr;
-        etl::string_stream valueStrStream(valueStr);
-        valueStrStream << wholeNumber << "." << tenths;
-        publishToSubscriber(subscriber, valueStr, true);
+const char *DataModelTenthsInt16Leaf::formattedValue() {
+    if (valueText[0] == 0) {
+        char *wholeNumber = valueText;
+        if (tenths < 0) {
+            *wholeNumber++ = '-';
+        }
+        const uint32_t magnitude = tenths < 0 ? -tenths : tenths;
+        char *fraction = formatUInt32(magnitude / 10, wholeNumber);
+        *fraction++ = '.';
+        formatUInt32(magnitude % 10, fraction);
     }
+    return valueText;
 }
@@ -16,22 +16,29 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef DATA_MODEL_TENTHS_INT16_LEAF_H
-#define DATA_MODEL_TENTHS_INT16_LEAF_H
+#ifndef DATA_MODEL_TENTHSINT16_LEAF_H
+#define DATA_MODEL_TENTHSINT16_LEAF_H
 
 #include "DataModelRetainedValueLeaf.h"
 
 #include <stdint.h>
+#include <stddef.h>
 
+// The value is set as a single signed count of tenths, so that values between 0 and -1 keep their
+// sign.
 class DataModelTenthsInt16Leaf : public DataModelRetainedValueLeaf {
-   private:
-        int16_t wholeNumber;
-        uint8_t tenths;
+    private:
+        static constexpr size_t maxValueTextLength = 10;
+
+        int32_t tenths;
+        char valueText[maxValueTextLength + 1];
+
+    protected:
+        virtual const char *formattedValue() override;
 
     public:
         DataModelTenthsInt16Leaf(const char *name, DataModelElement *parent);
-        void set(int16_t wholeNumber, uint8_t tenths);
-        virtual void sendRetainedValue(DataModelSubscriber &subscriber) override;
+        void set(int32_t tenths);
 };
 
 #endif
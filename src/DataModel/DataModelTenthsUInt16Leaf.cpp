@@ -17,36 +17,31 @@
  */
 
 #include "DataModelTenthsUInt16Leaf.h"
-#include "DataModelLeaf.h"
+#include "DataModelRetainedValueLeaf.h"
 
-#include <etl/string.h>
-#include <etl/string_stream.h>
+#include "Util/StringTools.h"
 
 #include <stdint.h>
 
-constexpr size_t maxStringLength = 7;
-
 DataModelTenthsUInt16Leaf::DataModelTenthsUInt16Leaf(const char *name, DataModelElement *parent)
     : DataModelRetainedValueLeaf(name, parent) {
+    valueText[0] = 0;
 }
 
 void DataModelTenthsUInt16Leaf::set(uint16_t wholeNumber, uint8_t tenths) {
     if (!hasValue() || this->wholeNumber != wholeNumber || this->tenths != tenths) {
         this->wholeNumber = wholeNumber;
         this->tenths = tenths;
+        valueText[0] = 0;
         updated();
-        etl::string<maxStringLength> valueStr;
-        etl::string_stream valueStrStream(valueStr);
-        valueStrStream << wholeNumber << "." << tenths;
-        *this << valueStr;
     }
 }
 
-void DataModelTenthsUInt16Leaf::sendRetainedValue(DataModelSubscriber &subscriber) {
-    if (hasValue()) {
-        etl::string<maxStringLength> valueStr;
-        etl::string_stream valueStrStream(valueStr);
-        valueStrStream << wholeNumber << "." << tenths;
-        publishToSubscriber(subscriber, valueStr, true);
+const char *DataModelTenthsUInt16Leaf::formattedValue() {
+    if (valueText[0] == 0) {
+        char *fraction = formatUInt32(wholeNumber, valueText);
+        *fraction++ = '.';
+        formatUInt32(tenths, fraction);
     }
+    return valueText;
 }
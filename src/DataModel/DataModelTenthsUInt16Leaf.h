@@ -16,22 +16,28 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef DATA_MODEL_TENTHS_UINT16_LEAF_H
-#define DATA_MODEL_TENTHS_UINT16_LEAF_H
+#ifndef DATA_MODEL_TENTHSUINT16_LEAF_H
+#define DATA_MODEL_TENTHSUINT16_LEAF_H
 
 #include "DataModelRetainedValueLeaf.h"
 
 #include <stdint.h>
+#include <stddef.h>
 
 class DataModelTenthsUInt16Leaf : public DataModelRetainedValueLeaf {
-   private:
+    private:
+        static constexpr size_t maxValueTextLength = 9;
+
         uint16_t wholeNumber;
         uint8_t tenths;
+        char valueText[maxValueTextLength + 1];
+
+    protected:
+        virtual const char *formattedValue() override;
 
     public:
         DataModelTenthsUInt16Leaf(const char *name, DataModelElement *parent);
         void set(uint16_t wholeNumber, uint8_t tenths);
-        virtual void sendRetainedValue(DataModelSubscriber &subscriber) override;
 };
 
 #endif
@@ -17,38 +17,37 @@
  */
 
 #include "DataModelUInt16Leaf.h"
-#include "DataModelLeaf.h"
+#include "DataModelRetainedValueLeaf.h"
 
-#include <etl/string.h>
-#include <etl/to_string.h>
+#include "Util/StringTools.h"
 
 #include <stdint.h>
 
 DataModelUInt16Leaf::DataModelUInt16Leaf(const char *name, DataModelElement *parent)
     : DataModelRetainedValueLeaf(name, parent) {
+    valueText[0] = 0;
 }
 
 DataModelUInt16Leaf & DataModelUInt16Leaf::operator = (const uint16_t value) {
     if (!hasValue() || this->value != value) {
         this->value = value;
+        valueText[0] = 0;
         updated();
-        *this << (uint32_t)value;
     }
-
     return *this;
 }
 
 DataModelUInt16Leaf DataModelUInt16Leaf::operator ++ (int) {
     value++;
+    valueText[0] = 0;
     updated();
-    *this << (uint32_t)value;
     return *this;
 }
 
 DataModelUInt16Leaf DataModelUInt16Leaf::operator -- (int) {
     value--;
+    valueText[0] = 0;
     updated();
-    *this << (uint32_t)value;
     return *this;
 }
 
@@ -56,11 +55,9 @@ DataModelUInt16Leaf::operator uint16_t() const {
     return value;
 }
 
-
-void DataModelUInt16Leaf::sendRetainedValue(DataModelSubscriber &subscriber) {
-    if (hasValue()) {
-        etl::string<3> valueStr;
-        etl::to_string(value, valueStr);
-        publishToSubscriber(subscriber, valueStr, true);
+const char *DataModelUInt16Leaf::formattedValue() {
+    if (valueText[0] == 0) {
+        formatUInt32(value, valueText);
     }
+    return valueText;
 }
@@ -22,10 +22,17 @@
 #include "DataModelRetainedValueLeaf.h"
 
 #include <stdint.h>
+#include <stddef.h>
 
 class DataModelUInt16Leaf : public DataModelRetainedValueLeaf {
-   private:
-        uint8_t value;
+    private:
+        static constexpr size_t maxValueTextLength = 5;
+
+        uint16_t value;
+        char valueText[maxValueTextLength + 1];
+
+    protected:
+        virtual const char *formattedValue() override;
 
     public:
         DataModelUInt16Leaf(const char *name, DataModelElement *parent);
@@ -33,7 +40,6 @@ class DataModelUInt16Leaf : public DataModelRetainedValueLeaf {
         DataModelUInt16Leaf operator ++ (int);
         DataModelUInt16Leaf operator -- (int);
         operator uint16_t() const;
-        virtual void sendRetainedValue(DataModelSubscriber &subscriber) override;
 };
 
 #endif
@@ -17,38 +17,37 @@
  */
 
 #include "DataModelUInt32Leaf.h"
-#include "DataModelLeaf.h"
+#include "DataModelRetainedValueLeaf.h"
 
-#include <etl/string.h>
-#include <etl/to_string.h>
+#include "Util/StringTools.h"
 
 #include <stdint.h>
 
 DataModelUInt32Leaf::DataModelUInt32Leaf(const char *name, DataModelElement *parent)
     : DataModelRetainedValueLeaf(name, parent) {
+    valueText[0] = 0;
 }
 
 DataModelUInt32Leaf & DataModelUInt32Leaf::operator = (const uint32_t value) {
     if (!hasValue() || this->value != value) {
         this->value = value;
+        valueText[0] = 0;
         updated();
-        *this << value;
     }
-
     return *this;
 }
 
 DataModelUInt32Leaf DataModelUInt32Leaf::operator ++ (int) {
     value++;
+    valueText[0] = 0;
     updated();
-    *this << value;
     return *this;
 }
 
 DataModelUInt32Leaf DataModelUInt32Leaf::operator -- (int) {
     value--;
+    valueText[0] = 0;
     updated();
-    *this << value;
     return *this;
 }
 
@@ -56,11 +55,9 @@ DataModelUInt32Leaf::operator uint32_t() const {
     return value;
 }
 
-
-void DataModelUInt32Leaf::sendRetainedValue(DataModelSubscriber &subscriber) {
-    if (hasValue()) {
-        etl::string<12> valueStr;
-        etl::to_string(value, valueStr);
-        publishToSubscriber(subscriber, valueStr, true);
+const char *DataModelUInt32Leaf::formattedValue() {
+    if (valueText[0] == 0) {
+        formatUInt32(value, valueText);
     }
+    return valueText;
 }
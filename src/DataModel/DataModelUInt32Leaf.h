@@ -22,10 +22,17 @@
 #include "DataModelRetainedValueLeaf.h"
 
 #include <stdint.h>
+#include <stddef.h>
 
 class DataModelUInt32Leaf : public DataModelRetainedValueLeaf {
-   private:
+    private:
+        static constexpr size_t maxValueTextLength = 10;
+
         uint32_t value;
+        char valueText[maxValueTextLength + 1];
+
+    protected:
+        virtual const char *formattedValue() override;
 
     public:
         DataModelUInt32Leaf(const char *name, DataModelElement *parent);
@@ -33,7 +40,6 @@ class DataModelUInt32Leaf : public DataModelRetainedValueLeaf {
         DataModelUInt32Leaf operator ++ (int);
         DataModelUInt32Leaf operator -- (int);
         operator uint32_t() const;
-        virtual void sendRetainedValue(DataModelSubscriber &subscriber) override;
 };
 
 #endif
@@ -17,38 +17,37 @@
  */
 
 #include "DataModelUInt8Leaf.h"
-#include "DataModelLeaf.h"
+#include "DataModelRetainedValueLeaf.h"
 
-#include <etl/string.h>
-#include <etl/to_string.h>
+#include "Util/StringTools.h"
 
 #include <stdint.h>
 
 DataModelUInt8Leaf::DataModelUInt8Leaf(const char *name, DataModelElement *parent)
     : DataModelRetainedValueLeaf(name, parent) {
+    valueText[0] = 0;
 }
 
 DataModelUInt8Leaf & DataModelUInt8Leaf::operator = (const uint8_t value) {
     if (!hasValue() || this->value != value) {
         this->value = value;
+        valueText[0] = 0;
         updated();
-        *this << (uint32_t)value;
     }
-
     return *this;
 }
 
 DataModelUInt8Leaf DataModelUInt8Leaf::operator ++ (int) {
     value++;
+    valueText[0] = 0;
     updated();
-    *this << (uint32_t)value;
     return *this;
 }
 
 DataModelUInt8Leaf DataModelUInt8Leaf::operator -- (int) {
     value--;
+    valueText[0] = 0;
     updated();
-    *this << (uint32_t)value;
     return *this;
 }
 
@@ -56,11 +55,9 @@ DataModelUInt8Leaf::operator uint8_t() const {
     return value;
 }
 
-
-void DataModelUInt8Leaf::sendRetainedValue(DataModelSubscriber &subscriber) {
-    if (hasValue()) {
-        etl::string<3> valueStr;
-        etl::to_string(value, valueStr);
-        publishToSubscriber(subscriber, valueStr, true);
+const char *DataModelUInt8Leaf::formattedValue() {
+    if (valueText[0] == 0) {
+        formatUInt32(value, valueText);
     }
+    return valueText;
 }
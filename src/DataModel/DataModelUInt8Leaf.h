@@ -22,10 +22,17 @@
 #include "DataModelRetainedValueLeaf.h"
 
 #include <stdint.h>
+#include <stddef.h>
 
 class DataModelUInt8Leaf : public DataModelRetainedValueLeaf {
-   private:
+    private:
+        static constexpr size_t maxValueTextLength = 3;
+
         uint8_t value;
+        char valueText[maxValueTextLength + 1];
+
+    protected:
+        virtual const char *formattedValue() override;
 
     public:
         DataModelUInt8Leaf(const char *name, DataModelElement *parent);
@@ -33,7 +40,6 @@ class DataModelUInt8Leaf : public DataModelRetainedValueLeaf {
         DataModelUInt8Leaf operator ++ (int);
         DataModelUInt8Leaf operator -- (int);
         operator uint8_t() const;
-        virtual void sendRetainedValue(DataModelSubscriber &subscriber) override;
 };
 
 #endif
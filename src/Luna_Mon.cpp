@@ -16,7 +16,12 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "Version.h"
+
 #include "NMEA/NMEASource.h"
+#include "NMEA/NMEASentenceFilter.h"
+#include "NMEA/NMEADuplicateSuppressor.h"
+#include "NMEA/NMEAMsgType.h"
 
 #include "WiFiManager/WiFiManager.h"
 
@@ -28,30 +33,66 @@
 
 #include "NMEADataModelBridge/NMEADataModelBridge.h"
 
+#include "AIS/AISDecoder.h"
+#include "AIS/AISTargetTable.h"
+
 #include "StatsManager/StatsManager.h"
+#include "StatsManager/LoopProfiler.h"
 
 #include "Util/TimeConstants.h"
 
 #include <Arduino.h>
 
 StatsManager statsManager;
-NMEASource usbSerialNMEASource(Serial, sysNMEAUSBMessages, sysNMEAUSBMessageRate, statsManager);
+NMEASource usbSerialNMEASource(Serial, sysNMEAUSBMessages, sysNMEAUSBMessageRate, sysNMEAUSBBacklog,
+                               sysNMEAUSBBudgetExhaustions, sysNMEAUSBOverlengthLines,
+                               statsManager);
 WiFiManager wifiManager;
 NMEAWiFiSource nmeaWiFiSource(wifiManager, sysNMEAWiFiMessages, sysNMEAWiFiMessageRate,
-                              sysNEMAWiFiState, statsManager);
+                              sysNMEAWiFiBacklog, sysNMEAWiFiBudgetExhaustions,
+                              sysNMEAWiFiOverlengthLines, sysNEMAWiFiState, statsManager);
+NMEASentenceFilter usbSerialNMEAFilter(sysNMEAUSBFiltered, statsManager);
+NMEASentenceFilter nmeaWiFiFilter(sysNMEAWiFiFiltered, statsManager);
+NMEADuplicateSuppressor nmeaDuplicateSuppressor(statsManager);
 MQTTBroker mqttBroker(statsManager);
 DataModel dataModel(statsManager);
 NMEADataModelBridge nmeaDataModelBridge(statsManager);
+AISDecoder aisDecoder(statsManager);
+AISTargetTable aisTargetTable(statsManager);
+#if LOOP_PROFILING
+LoopProfiler loopProfiler(statsManager);
+#endif
 
 void setup() {
     logger.setLevel(LOGGER_LEVEL_DEBUG);
     logger.enableModuleDebug(LOGGER_MODULE_WIFI_MANAGER);
     logger.enableModuleDebug(LOGGER_MODULE_NMEA);
+    // The logger is defined along with its console rather than with the objects above, so it's
+    // added to the stats manager here.
+    statsManager.addStatsHolder(&logger);
 
+    // Leaves are only written once setup() runs, as the global objects above may be constructed
+    // before those defined in other files.
+    sysBrokerVersion = VERSION;
     sysBrokerUptime = millis() / msInSecond;
 
     usbSerialNMEASource.addMessageHandler(nmeaDataModelBridge);
     nmeaWiFiSource.addMessageHandler(nmeaDataModelBridge);
+    usbSerialNMEASource.addMessageHandler(aisDecoder);
+    nmeaWiFiSource.addMessageHandler(aisDecoder);
+    aisDecoder.addMessageHandler(aisTargetTable);
+
+    // Nothing consumes these, so don't spend any time on them.
+    usbSerialNMEAFilter.reject(nmeaMsgTypeCode('T', 'X', 'T'));
+    usbSerialNMEASource.setSentenceFilter(usbSerialNMEAFilter);
+    nmeaWiFiFilter.reject(nmeaMsgTypeCode('T', 'X', 'T'));
+    nmeaWiFiSource.setSentenceFilter(nmeaWiFiFilter);
+
+    // The same instruments may reach us both directly and through a WiFi bridge. The USB
+    // connection has the lower latency, so it's the one that wins.
+    usbSerialNMEASource.setDuplicateSuppressor(nmeaDuplicateSuppressor, sysNMEAUSBDuplicates,
+                                               true);
+    nmeaWiFiSource.setDuplicateSuppressor(nmeaDuplicateSuppressor, sysNMEAWiFiDuplicates);
 
     Serial.begin(9600);
 
@@ -65,11 +106,24 @@ void setup() {
 }
 
 void loop() {
+    LOOP_PROFILE_START(loopProfiler);
     wifiManager.service();
+    LOOP_PROFILE_STAGE(loopProfiler, LOOP_STAGE_WIFI_MANAGER);
     usbSerialNMEASource.service();
+    LOOP_PROFILE_STAGE(loopProfiler, LOOP_STAGE_USB_NMEA_SOURCE);
     nmeaWiFiSource.service();
+    LOOP_PROFILE_STAGE(loopProfiler, LOOP_STAGE_WIFI_NMEA_SOURCE);
+    nmeaDataModelBridge.service();
+    LOOP_PROFILE_STAGE(loopProfiler, LOOP_STAGE_NMEA_DATA_MODEL_BRIDGE);
+    aisTargetTable.service();
+    LOOP_PROFILE_STAGE(loopProfiler, LOOP_STAGE_AIS_TARGET_TABLE);
     mqttBroker.service();
+    LOOP_PROFILE_STAGE(loopProfiler, LOOP_STAGE_MQTT_BROKER);
     statsManager.service();
+    LOOP_PROFILE_STAGE(loopProfiler, LOOP_STAGE_STATS_MANAGER);
+    logger.service();
+    LOOP_PROFILE_STAGE(loopProfiler, LOOP_STAGE_LOGGER);
+    LOOP_PROFILE_END(loopProfiler);
 
     uint32_t currentUpTime = millis() / msInSecond;
     if ((currentUpTime % 10 == 0) && (currentUpTime != sysBrokerUptime)) {
@@ -61,6 +61,7 @@ MQTTBroker::MQTTBroker(StatsManager &statsManager)
     }
 
     dataModelDebugNeedsUpdating = true;
+    firstSessionToPublish = 0;
 
     sysBrokerClientsConnected = 0;
     sysBrokerClientsDisconnected = 0;
@@ -77,6 +78,8 @@ MQTTBroker::MQTTBroker(StatsManager &statsManager)
     sysBrokerMessagesSent = 0;
     publishMessagesDropped = 0;
     sysBrokerMessagesPublishDropped = 0;
+    publishBudgetExhaustions = 0;
+    sysBrokerPublishBudgetExhaustions = 0;
 }
 
 void MQTTBroker::begin(WiFiManager &wifiManager) {
@@ -129,6 +132,8 @@ void MQTTBroker::service() {
                 newClientRead = false;
             }
         } while (newClientRead);
+
+        publishPendingValues();
     }
 }
 
@@ -148,6 +153,7 @@ void MQTTBroker::exportStats(uint32_t msElapsed) {
     sysBrokerMessagesPublishReceived = publishMessagesReceived;
     sysBrokerMessagesPublishSent = publishMessagesSent;
     sysBrokerMessagesPublishDropped = publishMessagesDropped;
+    sysBrokerPublishBudgetExhaustions = publishBudgetExhaustions;
 }
 
 void MQTTBroker::handleNewWiFiClient(WiFiClient &wifiClient) {
@@ -156,8 +162,8 @@ void MQTTBroker::handleNewWiFiClient(WiFiClient &wifiClient) {
         refuseIncomingWiFiClient(wifiClient);
         return;
     }
-    logger << logNotify << "Established MQTT Connection from " << connection->ipAddress() << ":"
-           << connection->port() << eol;
+    LOG(logNotify) << "Established MQTT Connection from " << connection->ipAddress() << ":"
+                   << connection->port() << eol;
 
     serviceConnection(connection);
 }
@@ -183,12 +189,13 @@ void MQTTBroker::serviceConnection(MQTTConnection *connection) {
 }
 
 void MQTTBroker::publishToConnection(MQTTConnection *connection, etl::istring &clientID,
-                                 const char *topic, const char *value, bool retainedValue) {
-    logger << logDebugMQTT << "Publishing Topic '" << topic << "' to Client '" << clientID
-           << "' with value '" << value << "' and retain " << retainedValue << eol;
+                                     const char *topic, uint16_t topicLength, const char *value,
+                                     bool retainedValue) {
+    LOG(logDebugMQTT) << "Publishing Topic '" << topic << "' to Client '" << clientID
+                      << "' with value '" << value << "' and retain " << retainedValue << eol;
 
     if (connection) {
-        sendMQTTPublishMessage(connection, topic, value, false, 0, retainedValue, 0);
+        sendMQTTPublishMessage(connection, topic, topicLength, value, false, 0, retainedValue, 0);
     }
 }
 
@@ -230,9 +237,9 @@ void MQTTBroker::terminateConnection(MQTTConnection *connection) {
 
 void MQTTBroker::terminateSession(MQTTSession *session) {
     if (session->isConnected()) {
-        logger << logError
-               << "Attempted to terminate a Session that had an active Connection. Programmer error"
-               << eol;
+        LOG(logError)
+            << "Attempted to terminate a Session that had an active Connection. Programmer error"
+            << eol;
     }
 
     invalidateSession(session);
@@ -268,7 +275,7 @@ MQTTConnection *MQTTBroker::newConnection(WiFiClient &wifiClient) {
 }
 
 void MQTTBroker::wifiConnected() {
-    logger << logNotify << "Connected to WiFi, starting MQTT server." << eol;
+    LOG(logNotify) << "Connected to WiFi, starting MQTT server." << eol;
     wifiIsConnected = true;
     wifiServer.begin();
 }
@@ -293,8 +300,8 @@ void MQTTBroker::checkForLostConnections() {
 }
 
 void MQTTBroker::cleanupLostConnection(MQTTConnection &connection) {
-    logger << logDebugMQTT << "Lost TCP connection from " << connection.ipAddress() << ":"
-           << connection.port() << eol;
+    LOG(logDebugMQTT) << "Lost TCP connection from " << connection.ipAddress() << ":"
+                      << connection.port() << eol;
     if (connection.hasSession()) {
         MQTTSession *session = connection.session();
         bool retainConnection = session->disconnect();
@@ -328,10 +335,32 @@ void MQTTBroker::serviceSessions() {
     }
 }
 
+// Data Model changes are left pending for each subscriber rather than written out as they happen,
+// so that NMEA input isn't held up by a slow client. They're sent here, within a time budget, with
+// a different session going first each time so that a session with a lot pending doesn't keep the
+// others from their share.
+void MQTTBroker::publishPendingValues() {
+    const uint32_t startMicroseconds = micros();
+
+    unsigned sessionCount;
+    for (sessionCount = 0; sessionCount < maxMQTTSessions; sessionCount++) {
+        const unsigned sessionIndex = (firstSessionToPublish + sessionCount) % maxMQTTSessions;
+        if (sessionValid[sessionIndex] && sessions[sessionIndex].isConnected()) {
+            if (!dataModel.publishPending(sessions[sessionIndex], startMicroseconds,
+                                          maxPublishMicrosecondsPerService)) {
+                publishBudgetExhaustions++;
+                break;
+            }
+        }
+    }
+
+    firstSessionToPublish = (firstSessionToPublish + 1) % maxMQTTSessions;
+}
+
 void MQTTBroker::refuseIncomingWiFiClient(WiFiClient &wifiClient) {
-    logger << logWarning
-           << "Maximum number of MQTT WiFi sessions exceeded, refusing incoming connection from "
-           << wifiClient.remoteIP() << ":" << wifiClient.remotePort() << eol;
+    LOG(logWarning)
+        << "Maximum number of MQTT WiFi sessions exceeded, refusing incoming connection from "
+        << wifiClient.remoteIP() << ":" << wifiClient.remotePort() << eol;
 
     wifiClient.flush();
     wifiClient.stop();
@@ -376,16 +405,16 @@ void MQTTBroker::messageReceived(MQTTConnection *connection, MQTTMessage &messag
 
         case MQTT_MSG_PUBREC:
             publishMessagesReceived++;
-            logger << logWarning << "Received unimplemented message type "
-                   << message.messageTypeStr() << eol;
+            LOG(logWarning) << "Received unimplemented message type "
+                            << message.messageTypeStr() << eol;
             break;
 
         case MQTT_MSG_PUBACK:
         case MQTT_MSG_PUBREL:
         case MQTT_MSG_PUBCOMP:
         default:
-            logger << logWarning << "Received unimplemented message type "
-                   << message.messageTypeStr() << eol;
+            LOG(logWarning) << "Received unimplemented message type "
+                            << message.messageTypeStr() << eol;
     }
 
     connection->resetMessageBuffer();
@@ -394,13 +423,13 @@ void MQTTBroker::messageReceived(MQTTConnection *connection, MQTTMessage &messag
 void MQTTBroker::connectMessageReceived(MQTTConnection *connection, MQTTMessage &message) {
     // Per the MQTT specification, we treat a second CONNECT for a connection as a protocol error.
     if (connection->hasSession()) {
-        logger << logWarning << "Second MQTT CONNECT received for a connection." << eol;
+        LOG(logWarning) << "Second MQTT CONNECT received for a connection." << eol;
         terminateConnection(connection);
     }
 
     MQTTConnectMessage connectMessage(message);
     if (!connectMessage.parse()) {
-        logger << logWarning << "Bad connect message. Terminating connection." << eol;
+        LOG(logWarning) << "Bad connect message. Terminating connection." << eol;
         terminateConnection(connection);
         return;
     }
@@ -408,8 +437,8 @@ void MQTTBroker::connectMessageReceived(MQTTConnection *connection, MQTTMessage
     uint8_t errorCode;
     errorCode = connectMessage.sanityCheck();
     if (errorCode != MQTT_CONNACK_ACCEPTED) {
-        logger << logWarning << "Terminating connection due to failed CONNECT message sanity check"
-               << eol;
+        LOG(logWarning) << "Terminating connection due to failed CONNECT message sanity check"
+                        << eol;
         sendMQTTConnectAckMessage(connection, false, errorCode);
         return;
     }
@@ -417,17 +446,17 @@ void MQTTBroker::connectMessageReceived(MQTTConnection *connection, MQTTMessage
     // Since this is a light weight broker, and a work in progress, we reject a few currently
     // unsupported types of connections.
     if (connectMessage.hasWill()) {
-        logger << logWarning << "MQTT CONNECT with Will: Currently unsupported" << eol;
+        LOG(logWarning) << "MQTT CONNECT with Will: Currently unsupported" << eol;
         sendMQTTConnectAckMessage(connection, false, MQTT_CONNACK_REFUSED_SERVER_UNAVAILABLE);
         return;
     }
     if (connectMessage.hasUserName()) {
-        logger << logWarning << "MQTT CONNECT message with Password set" << eol;
+        LOG(logWarning) << "MQTT CONNECT message with Password set" << eol;
         sendMQTTConnectAckMessage(connection, false, MQTT_CONNACK_REFUSED_USERNAME_OR_PASSWORD);
         return;
     }
     if (connectMessage.hasPassword()) {
-        logger << logWarning << "MQTT CONNECT message with Password set" << eol;
+        LOG(logWarning) << "MQTT CONNECT message with Password set" << eol;
         sendMQTTConnectAckMessage(connection, false, MQTT_CONNACK_REFUSED_USERNAME_OR_PASSWORD);
         return;
     }
@@ -435,8 +464,8 @@ void MQTTBroker::connectMessageReceived(MQTTConnection *connection, MQTTMessage
     const MQTTString *clientIDStr = connectMessage.clientID();
     etl::string<maxMQTTClientIDLength> clientID;
     if (!clientIDStr->copyTo(clientID)) {
-        logger << logWarning << "MQTT CONNECT message with too long of a Client ID:" << *clientIDStr
-               << eol;
+        LOG(logWarning) << "MQTT CONNECT message with too long of a Client ID:" << *clientIDStr
+                        << eol;
         sendMQTTConnectAckMessage(connection, false, MQTT_CONNACK_REFUSED_IDENTIFIER_REJECTED);
         return;
     }
@@ -459,12 +488,12 @@ void MQTTBroker::connectMessageReceived(MQTTConnection *connection, MQTTMessage
     MQTTSession *session = findMatchingSession(clientID);
     if (session) {
         if (session->isConnected()) {
-            logger << logWarning << "MQTT CONNECT message received for a Client ID (" << clientID
-                   << ") that already has an active Connection" << eol;
+            LOG(logWarning) << "MQTT CONNECT message received for a Client ID (" << clientID
+                            << ") that already has an active Connection" << eol;
             sendMQTTConnectAckMessage(connection, false, MQTT_CONNACK_REFUSED_SERVER_UNAVAILABLE);
         } else {
-            logger << logDebugMQTT << "Attempting to re-establish the Session for Client '"
-                   << clientID << "'" << eol;
+            LOG(logDebugMQTT) << "Attempting to re-establish the Session for Client '"
+                              << clientID << "'" << eol;
             const bool cleanSession = connectMessage.cleanSession();
             session->reconnect(cleanSession, connection, keepAliveTime);
             connection->connectTo(session);
@@ -474,18 +503,18 @@ void MQTTBroker::connectMessageReceived(MQTTConnection *connection, MQTTMessage
     } else {
         session = findAvailableSession();
         if (session) {
-            logger << logDebugMQTT << "Starting new MQTT Session for Client '" << clientID << "'"
-                   << eol;
+            LOG(logDebugMQTT) << "Starting new MQTT Session for Client '" << clientID << "'"
+                              << eol;
             session->begin(this, connectMessage.cleanSession(), clientID, connection,
                            keepAliveTime);
             connection->connectTo(session);
-            logger << logDebugMQTT << "MQTT Client '" << clientID << "' connected with new Session"
-                   << eol;
+            LOG(logDebugMQTT) << "MQTT Client '" << clientID << "' connected with new Session"
+                              << eol;
             sendMQTTConnectAckMessage(connection, false, MQTT_CONNACK_ACCEPTED);
             dataModelDebugNeedsUpdating = true;
         } else {
-            logger << logWarning << "MQTT CONNECT with Sessions full. Client ID " << clientID
-                   << " refused." << eol;
+            LOG(logWarning) << "MQTT CONNECT with Sessions full. Client ID " << clientID
+                            << " refused." << eol;
             sendMQTTConnectAckMessage(connection, false, MQTT_CONNACK_REFUSED_SERVER_UNAVAILABLE);
         }
     }
@@ -519,9 +548,9 @@ MQTTSession *MQTTBroker::findAvailableSession() {
 
 void MQTTBroker::subscribeMessageReceived(MQTTConnection *connection, MQTTMessage &message) {
     if (!connection->hasSession()) {
-        logger << logWarning << "Received a Subscribe message from an unconnected Client ("
-               << connection->ipAddress() << ":" << connection->port()
-               << "). Terminating connection." << eol;
+        LOG(logWarning) << "Received a Subscribe message from an unconnected Client ("
+                        << connection->ipAddress() << ":" << connection->port()
+                        << "). Terminating connection." << eol;
         terminateConnection(connection);
         return;
     }
@@ -529,8 +558,8 @@ void MQTTBroker::subscribeMessageReceived(MQTTConnection *connection, MQTTMessag
 
     MQTTSubscribeMessage subscribeMessage(message);
     if (!subscribeMessage.parse()) {
-        logger << logWarning << "Bad subscribe message from Client '" << session->name()
-               << "'. Terminating connection." << eol;
+        LOG(logWarning) << "Bad subscribe message from Client '" << session->name()
+                        << "'. Terminating connection." << eol;
         terminateConnection(connection);
         return;
     }
@@ -546,37 +575,38 @@ void MQTTBroker::subscribeMessageReceived(MQTTConnection *connection, MQTTMessag
         MQTTString *topicFilterStr;
         uint8_t maxQoS;
         if (!subscribeMessage.getTopicFilter(topicFilterStr, maxQoS)) {
-            logger << logError << "MQTT SUBSCRIBE has a messed up number of topic filters" << eol;
+            LOG(logError) << "MQTT SUBSCRIBE has a messed up number of topic filters" << eol;
             break;
         }
 
-        logger << logDebugMQTT << "MQTT Client '" << session->name() << "' wants to subscribe to '"
-               << *topicFilterStr << "' with max QoS " << maxQoS << eol;
+        LOG(logDebugMQTT) << "MQTT Client '" << session->name() << "' wants to subscribe to '"
+                          << *topicFilterStr << "' with max QoS " << maxQoS << eol;
 
         char topicFilter[maxTopicFilterLength + 1];
         if (!topicFilterStr->copyTo(topicFilter, maxTopicFilterLength)) {
-            logger << logWarning << "MQTT SUBSCRIBE message with too long of a Topic Filter '"
-                   << *topicFilterStr << "'" << eol;
+            LOG(logWarning) << "MQTT SUBSCRIBE message with too long of a Topic Filter '"
+                            << *topicFilterStr << "'" << eol;
             subscribeResults[topicFilterIndex] = mqttSubscribeResult(false, 0);
         } else {
-            if (dataModel.subscribe(topicFilter, *session, (uint32_t)maxQoS)) {
-                logger << logDebugMQTT << "Topic Filter '" << topicFilter << "' subscribed to by '"
-                       << session->name() << "'" << eol;
+            if (dataModel.subscribe(topicFilter, *session)) {
+                LOG(logDebugMQTT) << "Topic Filter '" << topicFilter << "' subscribed to by '"
+                                  << session->name() << "'" << eol;
                 subscribeResults[topicFilterIndex] = mqttSubscribeResult(true, 0);
             } else {
-                logger << logWarning << "Client '" << session->name()
-                       << "' failed to subscribe to Topic Filter '" << topicFilter << "'" << eol;
+                LOG(logWarning) << "Client '" << session->name()
+                                << "' failed to subscribe to Topic Filter '" << topicFilter << "'"
+                                << eol;
                  subscribeResults[topicFilterIndex] = mqttSubscribeResult(false, 0);
            }
         }
     }
 
-    logger << logDebugMQTT << "Sending SUBACK message with " << topicFilterCount
-           << " results to Client '" << session->name() << "'" << eol;
+    LOG(logDebugMQTT) << "Sending SUBACK message with " << topicFilterCount
+                      << " results to Client '" << session->name() << "'" << eol;
     if (!sendMQTTSubscribeAckMessage(connection, subscribeMessage.packetId(), topicFilterCount,
                                      subscribeResults)) {
-        logger << logError << "Failed to send SUBACK message to Client '" << session->name() << "'"
-               << eol;
+        LOG(logError) << "Failed to send SUBACK message to Client '" << session->name() << "'"
+                      << eol;
     }
 
     free(subscribeResults);
@@ -584,9 +614,9 @@ void MQTTBroker::subscribeMessageReceived(MQTTConnection *connection, MQTTMessag
 
 void MQTTBroker::unsubscribeMessageReceived(MQTTConnection *connection, MQTTMessage &message) {
     if (!connection->hasSession()) {
-        logger << logWarning << "Received an unsubscribe message from an unconnected Client ("
-               << connection->ipAddress() << ":" << connection->port()
-               << "). Terminating connection." << eol;
+        LOG(logWarning) << "Received an unsubscribe message from an unconnected Client ("
+                        << connection->ipAddress() << ":" << connection->port()
+                        << "). Terminating connection." << eol;
         terminateConnection(connection);
         return;
     }
@@ -594,8 +624,8 @@ void MQTTBroker::unsubscribeMessageReceived(MQTTConnection *connection, MQTTMess
 
     MQTTUnsubscribeMessage unsubscribeMessage(message);
     if (!unsubscribeMessage.parse()) {
-        logger << logWarning << "Bad unsubscribe message from Client '" << session->name()
-               << "'. Terminating connection." << eol;
+        LOG(logWarning) << "Bad unsubscribe message from Client '" << session->name()
+                        << "'. Terminating connection." << eol;
         terminateConnection(connection);
         return;
     }
@@ -607,29 +637,29 @@ void MQTTBroker::unsubscribeMessageReceived(MQTTConnection *connection, MQTTMess
     for (topicFilterIndex = 0; topicFilterIndex < topicFilterCount; topicFilterIndex++) {
         MQTTString *topicFilterStr;
         if (!unsubscribeMessage.getTopicFilter(topicFilterStr)) {
-            logger << logError << "MQTT UNSUBSCRIBE has a messed up number of topic filters" << eol;
+            LOG(logError) << "MQTT UNSUBSCRIBE has a messed up number of topic filters" << eol;
             break;
         }
 
-        logger << logDebugMQTT << "MQTT Client '" << session->name()
-               << "' wants to unsubscribe from '" << *topicFilterStr << "'" << eol;
+        LOG(logDebugMQTT) << "MQTT Client '" << session->name()
+                          << "' wants to unsubscribe from '" << *topicFilterStr << "'" << eol;
 
         char topicFilter[maxTopicFilterLength + 1];
         if (!topicFilterStr->copyTo(topicFilter, maxTopicFilterLength)) {
-            logger << logWarning << "MQTT UNSUBSCRIBE message with too long of a Topic Filter '"
-                   << *topicFilterStr << "'" << eol;
+            LOG(logWarning) << "MQTT UNSUBSCRIBE message with too long of a Topic Filter '"
+                            << *topicFilterStr << "'" << eol;
         } else {
             dataModel.unsubscribe(topicFilter, *session);
-            logger << logDebugMQTT << "Topic Filter '" << topicFilter << "' unsubscribed from by '"
-                   << session->name() << "'" << eol;
+            LOG(logDebugMQTT) << "Topic Filter '" << topicFilter << "' unsubscribed from by '"
+                              << session->name() << "'" << eol;
         }
     }
 
-    logger << logDebugMQTT << "Sending UNSUBACK message to Client '" << session->name() << "'"
-           << eol;
+    LOG(logDebugMQTT) << "Sending UNSUBACK message to Client '" << session->name() << "'"
+                      << eol;
     if (!sendMQTTUnsubscribeAckMessage(connection, unsubscribeMessage.packetId())) {
-        logger << logError << "Failed to send UNSUBACK message to Client '" << session->name()
-               << "'" << eol;
+        LOG(logError) << "Failed to send UNSUBACK message to Client '" << session->name()
+                      << "'" << eol;
     }
 }
 
@@ -637,7 +667,7 @@ void MQTTBroker::pingRequestMessageReceived(MQTTConnection *connection, MQTTMess
     MQTTPingRequestMessage pingRequestMessage(message);
 
     if (!pingRequestMessage.parse()) {
-        logger << logError << "Bad MQTT PINGREQ message. Terminating connection." << eol;
+        LOG(logError) << "Bad MQTT PINGREQ message. Terminating connection." << eol;
         terminateConnection(connection);
         return;
     }
@@ -645,10 +675,10 @@ void MQTTBroker::pingRequestMessageReceived(MQTTConnection *connection, MQTTMess
     // Flag if we're getting a PINGREQ for a connection that didn't actually get connected with a
     // session.
     if (!connection->hasSession()) {
-        logger << logError
-               << "Received MQTT PINGREQ message for a connection that wasn't connected to a "
+        LOG(logError)
+            << "Received MQTT PINGREQ message for a connection that wasn't connected to a "
                   "session."
-               << eol;
+            << eol;
         terminateConnection(connection);
         return;
     }
@@ -656,11 +686,11 @@ void MQTTBroker::pingRequestMessageReceived(MQTTConnection *connection, MQTTMess
     MQTTSession *session = connection->session();
     session->resetKeepAliveTimer();
 
-    logger << logDebugMQTT << "Sending MQTT PINGRESP message to Client '" << session->name() << eol;
+    LOG(logDebugMQTT) << "Sending MQTT PINGRESP message to Client '" << session->name() << eol;
 
     if (!sendMQTTPingResponseMessage(connection)) {
-        logger << logError << "Failed to sent MQTT PINGRESP message to "
-               << connection->ipAddress() << ":" << connection->port() << eol;
+        LOG(logError) << "Failed to sent MQTT PINGRESP message to "
+                      << connection->ipAddress() << ":" << connection->port() << eol;
     }
 }
 
@@ -670,7 +700,7 @@ void MQTTBroker::disconnectMessageReceived(MQTTConnection *connection, MQTTMessa
     // We do this for the log message, the connection is going the way of the water buffalo either
     // way.
     if (!disconnectMessage.parse()) {
-        logger << logError << "Bad MQTT DISCONNECT message. Terminating connection." << eol;
+        LOG(logError) << "Bad MQTT DISCONNECT message. Terminating connection." << eol;
         terminateConnection(connection);
         return;
     }
@@ -678,27 +708,27 @@ void MQTTBroker::disconnectMessageReceived(MQTTConnection *connection, MQTTMessa
     // Flag if we're getting a DISCONNECT for a connection that didn't actually get connected with a
     // session.
     if (!connection->hasSession()) {
-        logger << logError
-               << "Received MQTT DISCONNECT message for a connection that wasn't connected to a "
+        LOG(logError)
+            << "Received MQTT DISCONNECT message for a connection that wasn't connected to a "
                   "session."
-               << eol;
+            << eol;
         terminateConnection(connection);
         return;
     }
 
-    logger << logDebugMQTT << "Stopping client due to DISCONNECT" << eol;
+    LOG(logDebugMQTT) << "Stopping client due to DISCONNECT" << eol;
     terminateConnection(connection);
 }
 
 void MQTTBroker::reservedMsgReceivedError(MQTTConnection *connection, MQTTMessage &message) {
-    logger << logError << "Received reserved message " << message.messageTypeStr()
-           << ". Terminating connection" << eol;
+    LOG(logError) << "Received reserved message " << message.messageTypeStr()
+                  << ". Terminating connection" << eol;
     terminateConnection(connection);
 }
 
 void MQTTBroker::serverOnlyMsgReceivedError(MQTTConnection *connection, MQTTMessage &message) {
-    logger << logError << "Received server->client only message " << message.messageTypeStr()
-           << ". Terminating connection" << eol;
+    LOG(logError) << "Received server->client only message " << message.messageTypeStr()
+                  << ". Terminating connection" << eol;
     terminateConnection(connection);
 }
 
@@ -749,8 +779,8 @@ bool MQTTBroker::sendMQTTPingResponseMessage(MQTTConnection *connection) {
 }
 
 bool MQTTBroker::sendMQTTPublishMessage(MQTTConnection *connection, const char *topic,
-                                        const char *value, bool dup, uint8_t qosLevel,
-                                        bool retain, uint16_t packetId) {
+                                        uint16_t topicLength, const char *value, bool dup,
+                                        uint8_t qosLevel, bool retain, uint16_t packetId) {
     MQTTFixedHeader fixedHeader;
 
     fixedHeader.typeAndFlags = MQTT_MSG_PUBLISH << MQTT_MSG_TYPE_SHIFT;
@@ -768,7 +798,7 @@ bool MQTTBroker::sendMQTTPublishMessage(MQTTConnection *connection, const char *
 
     const size_t valueLength = strlen(value);
     uint32_t remainingLength;
-    remainingLength = strlen(topic) + 2 + valueLength;
+    remainingLength = topicLength + 2 + valueLength;
     if (qosLevel > 0) {
         remainingLength += 2;
     }
@@ -777,7 +807,7 @@ bool MQTTBroker::sendMQTTPublishMessage(MQTTConnection *connection, const char *
         return false;
     }
 
-    if (!mqttWriteMQTTString(connection, topic)) {
+    if (!mqttWriteMQTTString(connection, topic, topicLength)) {
         publishMessagesDropped++;
         return false;
     }
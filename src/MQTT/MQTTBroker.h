@@ -63,11 +63,17 @@ class MQTTBroker : WiFiManagerClient, public StatsHolder {
         // in the service routine.
         bool dataModelDebugNeedsUpdating;
 
+        // Publishing pending Data Model changes is limited to this much time per service call,
+        // starting with a different session each time.
+        static const uint32_t maxPublishMicrosecondsPerService = 4000;
+        unsigned firstSessionToPublish;
+
         uint32_t messagesReceived;
         uint32_t messagesSent;
         uint32_t publishMessagesReceived;
         uint32_t publishMessagesSent;
         uint32_t publishMessagesDropped;
+        uint32_t publishBudgetExhaustions;
 
         void checkForLostConnections();
         void cleanupLostConnection(MQTTConnection &connection);
@@ -76,6 +82,7 @@ class MQTTBroker : WiFiManagerClient, public StatsHolder {
         void serviceConnections();
         void handleNewWiFiClient(WiFiClient &wifiClient);
         void serviceConnection(MQTTConnection *connection);
+        void publishPendingValues();
         bool wifiClientIsExistingConnection(WiFiClient &wifiClient);
         MQTTConnection *newConnection(WiFiClient &wifiClient);
         MQTTSession *findMatchingSession(const etl::istring &clientID);
@@ -93,8 +100,8 @@ class MQTTBroker : WiFiManagerClient, public StatsHolder {
                                        uint8_t returnCode);
         bool sendMQTTPingResponseMessage(MQTTConnection *connection);
         bool sendMQTTPublishMessage(MQTTConnection *connection, const char *topic,
-                                    const char *value, bool dup, uint8_t qosLevel, bool retain,
-                                    uint16_t packetId);
+                                    uint16_t topicLength, const char *value, bool dup,
+                                    uint8_t qosLevel, bool retain, uint16_t packetId);
         bool sendMQTTUnsubscribeAckMessage(MQTTConnection *connection, uint16_t packetId);
         bool sendMQTTSubscribeAckMessage(MQTTConnection *connection, uint16_t packetId,
                                          uint8_t numberResults, uint8_t *results);
@@ -108,7 +115,8 @@ class MQTTBroker : WiFiManagerClient, public StatsHolder {
         void begin(WiFiManager &wifiManager);
         void service();
         void publishToConnection(MQTTConnection *connection, etl::istring &clientID,
-                                 const char *topic, const char *value, bool retainedValue);
+                                 const char *topic, uint16_t topicLength, const char *value,
+                                 bool retainedValue);
         void terminateConnection(MQTTConnection *connection);
         void terminateSession(MQTTSession *session);
         void wifiConnected() override;
@@ -30,15 +30,15 @@ MQTTConnectMessage::MQTTConnectMessage(MQTTMessage const &message) : MQTTMessage
 // Returns false if there's a protocol error that requires dropping the connection flat out.
 bool MQTTConnectMessage::parse() {
     if (fixedHeaderFlags() != 0) {
-        logger << logWarning << "Received MQTT CONNECT message with non-zero Fixed Header Flags"
-               << eol;
+        LOG(logWarning) << "Received MQTT CONNECT message with non-zero Fixed Header Flags"
+                        << eol;
         return false;
     }
 
     if (bytesAfterFixedHdr < sizeof(MQTTConnectVariableHeader)) {
-        logger << logWarning
-               << "Received MQTT CONNECT message with a size too small for the Variable Header."
-               << eol;
+        LOG(logWarning)
+            << "Received MQTT CONNECT message with a size too small for the Variable Header."
+            << eol;
         return false;
     }
 
@@ -56,31 +56,31 @@ bool MQTTConnectMessage::parse() {
         for (unsigned pos = 0; pos < protocolNameLength; pos++) {
             logger << logWarning << (char)variableHeader->protocolName[pos];
         }
-        logger << logWarning << "'" << eol;
+        LOG(logWarning) << "'" << eol;
         return false;
     }
 
     uint8_t flags = variableHeader->flags;
     if ((flags & MQTT_CONNECT_FLAGS_RESERVED_MASK) != 0) {
-        logger << logWarning
-               << "MQTT CONNECT message with non-zero Reserved flag in variable header" << eol;
+        LOG(logWarning)
+            << "MQTT CONNECT message with non-zero Reserved flag in variable header" << eol;
         return false;
     }
 
     if (hasWill()) {
         const uint8_t willQoS = MQTTConnectMessage::willQoS();
         if (willQoS > 2) {
-            logger << logWarning << "MQTT CONNECT message with bad Will QoS (" << willQoS << ")"
-                   << eol;
+            LOG(logWarning) << "MQTT CONNECT message with bad Will QoS (" << willQoS << ")"
+                            << eol;
             return false;
         }
     } else {
         if (willQoS() != 0) {
-            logger << logWarning << "MQTT CONNECT message with Will QoS, but no Will" << eol;
+            LOG(logWarning) << "MQTT CONNECT message with Will QoS, but no Will" << eol;
             return false;
         }
         if (willRetain()) {
-            logger << logWarning << "MQTT CONNECT message with Will Retain, but no Will" << eol;
+            LOG(logWarning) << "MQTT CONNECT message with Will Retain, but no Will" << eol;
             return false;
         }
     }
@@ -89,43 +89,43 @@ bool MQTTConnectMessage::parse() {
     uint32_t payloadBytesRemaining = bytesAfterVariableHdr;
 
     if (!parseString(clientIDStr, payloadPos, payloadBytesRemaining)) {
-        logger << logWarning << "MQTT CONNECT packet with payload too small for its Client ID"
-               << eol;
+        LOG(logWarning) << "MQTT CONNECT packet with payload too small for its Client ID"
+                        << eol;
         return false;
     }
 
     if (hasWill()) {
         if (!parseString(willTopicStr, payloadPos, payloadBytesRemaining)) {
-            logger << logWarning << "MQTT CONNECT packet with payload too small for its Will Topic"
-                   << eol;
+            LOG(logWarning) << "MQTT CONNECT packet with payload too small for its Will Topic"
+                            << eol;
             return false;
         }
         if (!parseString(willMessageStr, payloadPos, payloadBytesRemaining)) {
-            logger << logWarning
-                   << "MQTT CONNECT packet with payload too small for its Will Message" << eol;
+            LOG(logWarning)
+                << "MQTT CONNECT packet with payload too small for its Will Message" << eol;
             return false;
         }
     }
 
     if (hasUserName()) {
         if (!parseString(userNameStr, payloadPos, payloadBytesRemaining)) {
-            logger << logWarning << "MQTT CONNECT packet with payload too small for its User Name"
-                   << eol;
+            LOG(logWarning) << "MQTT CONNECT packet with payload too small for its User Name"
+                            << eol;
             return false;
         }
     }
 
     if (hasPassword()) {
         if (!parseString(passwordStr, payloadPos, payloadBytesRemaining)) {
-            logger << logWarning << "MQTT CONNECT packet with payload too small for its Password"
-                   << eol;
+            LOG(logWarning) << "MQTT CONNECT packet with payload too small for its Password"
+                            << eol;
             return false;
         }
     }
 
     if (payloadBytesRemaining) {
-        logger << logWarning << "MQTT CONNECT packet with " << payloadBytesRemaining
-               << " extra bytes" << eol;
+        LOG(logWarning) << "MQTT CONNECT packet with " << payloadBytesRemaining
+                        << " extra bytes" << eol;
         return false;
     }
 
@@ -134,22 +134,22 @@ bool MQTTConnectMessage::parse() {
 
 uint8_t MQTTConnectMessage::sanityCheck() {
     if (variableHeader->level != MQTT_PROTOCOL_LEVEL) {
-        logger << logWarning << "Unsupported MQTT protocol level in CONNECT message. Expected "
-               << MQTT_PROTOCOL_LEVEL << " got " << variableHeader->level << eol;
+        LOG(logWarning) << "Unsupported MQTT protocol level in CONNECT message. Expected "
+                        << MQTT_PROTOCOL_LEVEL << " got " << variableHeader->level << eol;
         return MQTT_CONNACK_REFUSED_PROTOCOL_VERSION;
     }
 
     // We accept zero length client IDs, but it's an error for the client to send one if it's not
     // also requesting a clean session since a broker couldn't pair them up in that case.
     if (clientIDStr->length() == 0 && !cleanSession()) {
-        logger << logWarning
-               << "MQTT CONNECT message with a zero length Client ID and Clean Session false"
-               << eol;
+        LOG(logWarning)
+            << "MQTT CONNECT message with a zero length Client ID and Clean Session false"
+            << eol;
         return MQTT_CONNACK_REFUSED_IDENTIFIER_REJECTED;
     }
 
-    logger << logDebugMQTT << "MQTT Connect with Client ID '" << *clientIDStr
-           << "' and Clean Session " << cleanSession() << eol;
+    LOG(logDebugMQTT) << "MQTT Connect with Client ID '" << *clientIDStr
+                      << "' and Clean Session " << cleanSession() << eol;
 
     return MQTT_CONNACK_ACCEPTED;
 }
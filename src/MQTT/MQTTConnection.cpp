@@ -173,9 +173,9 @@ void MQTTConnection::logIllegalRemainingLength() {
 }
 
 void MQTTConnection::logMessageSizeTooLarge() {
-    logger << logError << "Message size " << messageSize << " from " << wifiClient.remoteIP()
-           << ":" << wifiClient.remotePort() << " exceeds maximum allowable ("
-           << maxIncomingMessageSize << "). Aborting connection." << eol;
+    LOG(logError) << "Message size " << messageSize << " from " << wifiClient.remoteIP()
+                  << ":" << wifiClient.remotePort() << " exceeds maximum allowable ("
+                  << maxIncomingMessageSize << "). Aborting connection." << eol;
 }
 
 void MQTTConnection::readToBuffer(size_t readAmount) {
@@ -201,8 +201,8 @@ MQTTSession *MQTTConnection::session() {
 }
 
 void MQTTConnection::stop() {
-    logger << logDebugMQTT << "Stopping client " << wifiClient.remoteIP() << ":"
-           << wifiClient.remotePort() << eol;
+    LOG(logDebugMQTT) << "Stopping client " << wifiClient.remoteIP() << ":"
+                      << wifiClient.remotePort() << eol;
 
     wifiClient.flush();
     wifiClient.stop();
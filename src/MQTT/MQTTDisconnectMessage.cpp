@@ -29,14 +29,14 @@ MQTTDisconnectMessage::MQTTDisconnectMessage(MQTTMessage const &message) : MQTTM
 // messages for malformed packets. 
 bool MQTTDisconnectMessage::parse() {
     if (fixedHeaderFlags() != 0) {
-        logger << logWarning << "Received MQTT CONNECT message with non-zero Fixed Header Flags."
-               << eol;
+        LOG(logWarning) << "Received MQTT CONNECT message with non-zero Fixed Header Flags."
+                        << eol;
         return false;
     }
 
     if (bytesAfterFixedHdr) {
-        logger << logWarning << "MQTT DISCONNECT packet with " << bytesAfterFixedHdr
-               << " extra bytes" << eol;
+        LOG(logWarning) << "MQTT DISCONNECT packet with " << bytesAfterFixedHdr
+                        << " extra bytes" << eol;
         return false;
     }
 
@@ -25,14 +25,14 @@ MQTTPingRequestMessage::MQTTPingRequestMessage(MQTTMessage const &message) : MQT
 
 bool MQTTPingRequestMessage::parse() {
     if (fixedHeaderFlags() != 0x0) {
-        logger << logWarning << "Received MQTT PINGREQ message with invalid Fixed Header Flags"
-               << eol;
+        LOG(logWarning) << "Received MQTT PINGREQ message with invalid Fixed Header Flags"
+                        << eol;
         return false;
     }
 
     if (bytesAfterFixedHdr > 0) {
-        logger << logWarning << "Received MQTT PINGREQ message with extra data after Fixed Header"
-               << eol;
+        LOG(logWarning) << "Received MQTT PINGREQ message with extra data after Fixed Header"
+                        << eol;
         return false;
     }
 
@@ -47,8 +47,8 @@ void MQTTSession::begin(MQTTBroker *broker, bool cleanSession, const etl::istrin
     this->keepAliveTime = keepAliveTime;
     resetKeepAliveTimer();
 
-    logger << logDebugMQTT << "Established new session for Client ID '" << clientID
-           << "' with a keep alive of " << keepAliveTime << " sec"  << eol;
+    LOG(logDebugMQTT) << "Established new session for Client ID '" << clientID
+                      << "' with a keep alive of " << keepAliveTime << " sec"  << eol;
 }
 
 void MQTTSession::reconnect(bool newCleanSession, MQTTConnection *connection,
@@ -72,14 +72,15 @@ void MQTTSession::service() {
     // Do things like timeout sessions whose connection died and hasn't returned.
     if (isConnected()) {
         if (keepAliveTimer.expired()) {
-            logger << logNotify << "Keep alive time expired for Client '" << clientID
-                   << "'. Disconnecting..." << eol;
+            LOG(logNotify) << "Keep alive time expired for Client '" << clientID
+                           << "'. Disconnecting..." << eol;
             broker->terminateConnection(connection);
         }
     } else {
         if (tearDownTimer.expired()) {
-            logger << logDebugMQTT << "Client '" << clientID
-                   << "' failed to reconnect in the allotted time. Terminating Session" << eol;
+            LOG(logDebugMQTT) << "Client '" << clientID
+                              << "' failed to reconnect in the allotted time. Terminating Session"
+                              << eol;
             dataModel.unsubscribeAll(*this);
             broker->terminateSession(this);
         }
@@ -115,9 +116,11 @@ const etl::istring &MQTTSession::name() const {
     return clientID;
 }
 
-void MQTTSession::publish(const char *topic, const char *value, bool retainedValue) {
+void MQTTSession::publish(const char *topic, uint16_t topicLength, const char *value,
+                          bool retainedValue) {
     if (connection) {
-        broker->publishToConnection(connection, clientID, topic, value, retainedValue);
+        broker->publishToConnection(connection, clientID, topic, topicLength, value,
+                                    retainedValue);
     }
 }
 
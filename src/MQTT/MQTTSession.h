@@ -68,7 +68,8 @@ class MQTTSession : public DataModelSubscriber {
         void service();
         void resetKeepAliveTimer();
         virtual const etl::istring &name() const override;
-        virtual void publish(const char *topic, const char *value, bool retainedValue) override;
+        virtual void publish(const char *topic, uint16_t topicLength, const char *value,
+                             bool retainedValue) override;
         void updateSessionDebug(DataModelStringLeaf &debug);
 };
 
@@ -29,15 +29,15 @@ MQTTSubscribeMessage::MQTTSubscribeMessage(MQTTMessage const &message) : MQTTMes
 
 bool MQTTSubscribeMessage::parse() {
     if (fixedHeaderFlags() != 0x2) {
-        logger << logWarning << "Received MQTT SUBSCRIBE message with invalid Fixed Header Flags"
-               << eol;
+        LOG(logWarning) << "Received MQTT SUBSCRIBE message with invalid Fixed Header Flags"
+                        << eol;
         return false;
     }
 
     if (bytesAfterFixedHdr < sizeof(MQTTSubscribeVariableHeader)) {
-        logger << logWarning
-               << "Received MQTT SUBSCRIBE message with a size too small for the Variable Header."
-               << eol;
+        LOG(logWarning)
+            << "Received MQTT SUBSCRIBE message with a size too small for the Variable Header."
+            << eol;
         return false;
     }
 
@@ -45,13 +45,13 @@ bool MQTTSubscribeMessage::parse() {
     const uint32_t bytesAfterVariableHdr = bytesAfterFixedHdr - sizeof(MQTTSubscribeVariableHeader);
 
     if (packetId() == 0) {
-        logger << logWarning << "Received MQTT SUBSCRIBE message with zero Packet Indentifier."
-               << eol;
+        LOG(logWarning) << "Received MQTT SUBSCRIBE message with zero Packet Indentifier."
+                        << eol;
         return false;
     }
 
     if (bytesAfterVariableHdr == 0) {
-        logger << logWarning << "Received MQTT SUBSCRIBE message without any Topic Filters." << eol;
+        LOG(logWarning) << "Received MQTT SUBSCRIBE message without any Topic Filters." << eol;
         return false;
     }
 
@@ -64,27 +64,27 @@ bool MQTTSubscribeMessage::parse() {
     do {
         MQTTString *topicFilterStr;
         if (!parseString(topicFilterStr, payloadPos, payloadBytesRemaining)) {
-            logger << logWarning
-                   << "MQTT SUBSCRIBE message with payload too small for its Topic Filter" << eol;
+            LOG(logWarning)
+                << "MQTT SUBSCRIBE message with payload too small for its Topic Filter" << eol;
             return false;
         }
 
         if (topicFilterStr->length() == 0) {
-            logger << logWarning << "MQTT SUBSCRIBE message with zero length Topic Filter" << eol;
+            LOG(logWarning) << "MQTT SUBSCRIBE message with zero length Topic Filter" << eol;
             return false;
         }
 
         if (payloadBytesRemaining < 1) {
-            logger << logWarning << "MQTT SUBSCRIBE message with a Topic Filter missing its max QoS"
-                   << eol;
+            LOG(logWarning) << "MQTT SUBSCRIBE message with a Topic Filter missing its max QoS"
+                            << eol;
             return false;
         }
         uint8_t maxQoS = *payloadPos++;
         payloadBytesRemaining--;
 
         if (maxQoS > 2) {
-            logger << logWarning << "MQTT SUBSCRIBE message with illegal max QoS (" << Hex << maxQoS
-                   << ")" << eol;
+            LOG(logWarning) << "MQTT SUBSCRIBE message with illegal max QoS (" << Hex << maxQoS
+                            << ")" << eol;
             return false;
         }
 
@@ -29,15 +29,15 @@ MQTTUnsubscribeMessage::MQTTUnsubscribeMessage(MQTTMessage const &message) : MQT
 
 bool MQTTUnsubscribeMessage::parse() {
     if (fixedHeaderFlags() != 0x2) {
-        logger << logWarning << "Received MQTT UNSUBSCRIBE message with invalid Fixed Header Flags"
-               << eol;
+        LOG(logWarning) << "Received MQTT UNSUBSCRIBE message with invalid Fixed Header Flags"
+                        << eol;
         return false;
     }
 
     if (bytesAfterFixedHdr < sizeof(MQTTUnsubscribeVariableHeader)) {
-        logger << logWarning
-               << "Received MQTT UNSUBSCRIBE message with a size too small for the Variable Header."
-               << eol;
+        LOG(logWarning)
+            << "Received MQTT UNSUBSCRIBE message with a size too small for the Variable Header."
+            << eol;
         return false;
     }
 
@@ -46,14 +46,14 @@ bool MQTTUnsubscribeMessage::parse() {
                                             - sizeof(MQTTUnsubscribeVariableHeader);
 
     if (packetId() == 0) {
-        logger << logWarning << "Received MQTT UNSUBSCRIBE message with zero Packet Indentifier."
-               << eol;
+        LOG(logWarning) << "Received MQTT UNSUBSCRIBE message with zero Packet Indentifier."
+                        << eol;
         return false;
     }
 
     if (bytesAfterVariableHdr == 0) {
-        logger << logWarning << "Received MQTT UNSUBSCRIBE message without any Topic Filters."
-               << eol;
+        LOG(logWarning) << "Received MQTT UNSUBSCRIBE message without any Topic Filters."
+                        << eol;
         return false;
     }
 
@@ -66,13 +66,13 @@ bool MQTTUnsubscribeMessage::parse() {
     do {
         MQTTString *topicFilterStr;
         if (!parseString(topicFilterStr, payloadPos, payloadBytesRemaining)) {
-            logger << logWarning
-                   << "MQTT UNSUBSCRIBE message with payload too small for its Topic Filter" << eol;
+            LOG(logWarning)
+                << "MQTT UNSUBSCRIBE message with payload too small for its Topic Filter" << eol;
             return false;
         }
 
         if (topicFilterStr->length() == 0) {
-            logger << logWarning << "MQTT UNSUBSCRIBE message with zero length Topic Filter" << eol;
+            LOG(logWarning) << "MQTT UNSUBSCRIBE message with zero length Topic Filter" << eol;
             return false;
         }
 
@@ -48,8 +48,7 @@ bool mqttWriteUInt16(MQTTConnection *connection, uint16_t value) {
     return true;
 }
 
-bool mqttWriteMQTTString(MQTTConnection *connection, const char *string) {
-    const uint16_t length = strlen(string);
+bool mqttWriteMQTTString(MQTTConnection *connection, const char *string, uint16_t length) {
     if (!mqttWriteUInt16(connection, length)) {
         return false;
     }
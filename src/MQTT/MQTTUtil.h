@@ -25,6 +25,6 @@
 
 bool mqttWriteRemainingLength(MQTTConnection *connection, uint32_t remainingLength);
 bool mqttWriteUInt16(MQTTConnection *connection, uint16_t value);
-bool mqttWriteMQTTString(MQTTConnection *connection, const char *string);
+bool mqttWriteMQTTString(MQTTConnection *connection, const char *string, uint16_t length);
 
 #endif
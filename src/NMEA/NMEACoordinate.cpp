@@ -28,9 +28,9 @@
 #include <etl/string_view.h>
 #include <etl/to_arithmetic.h>
 #include <etl/string.h>
-#include <etl/string_stream.h>
 
 #include <stdint.h>
+#include <Arduino.h>
 
 bool NMEACoordinate::setDegrees(const etl::string_view &degreesView, uint8_t maxDegrees) {
     etl::to_arithmetic_result<uint8_t> conversionResult = etl::to_arithmetic<uint8_t>(degreesView);
@@ -47,53 +47,111 @@ bool NMEACoordinate::setDegrees(const etl::string_view &degreesView, uint8_t max
 }
 
 bool NMEACoordinate::setMinutes(const etl::string_view &minutesView) {
-    etl::string_view wholeMinutesView(minutesView.begin(), 2);
-    etl::to_arithmetic_result<uint8_t> wholeResult = etl::to_arithmetic<uint8_t>(wholeMinutesView);
-    if (!wholeResult.has_value()) {
+    if (minutesView.size() < 2 || !isDigit(minutesView[0]) || !isDigit(minutesView[1])) {
         return false;
     }
-    uint8_t wholeMinutes = wholeResult.value();
+    uint32_t wholeMinutes = decimalValue(minutesView[0]) * 10 + decimalValue(minutesView[1]);
     if (wholeMinutes > 59) {
         return false;
     }
 
+    uint32_t fraction = 0;
     if (minutesView.size() > 2) {
         if (minutesView[2] != '.') {
             return false;
         }
 
-        if (minutesView.size() > 3) {
-            etl::string_view decimalView(minutesView.begin() + 2, minutesView.end());
-            etl::to_arithmetic_result<float> decimalResult = etl::to_arithmetic<float>(decimalView);
-            if (!decimalResult.has_value()) {
+        // Accumulate up to six decimal digits, round on the seventh and validate the rest.
+        unsigned fractionDigits = 0;
+        bool roundUp = false;
+        for (size_t pos = 3; pos < minutesView.size(); pos++) {
+            const char digit = minutesView[pos];
+            if (!isDigit(digit)) {
                 return false;
             }
-            minutes = (float)wholeMinutes + decimalResult.value();
-        } else {
-            minutes = (float)wholeMinutes;
+            if (fractionDigits < minutesDecimalDigits) {
+                fraction = fraction * 10 + decimalValue(digit);
+                fractionDigits++;
+            } else if (pos == 3 + minutesDecimalDigits) {
+                roundUp = digit >= '5';
+            }
+        }
+        for (; fractionDigits < minutesDecimalDigits; fractionDigits++) {
+            fraction *= 10;
+        }
+        if (roundUp) {
+            fraction++;
         }
-    } else {
-        minutes = (float)wholeMinutes;
     }
 
+    microMinutes = wholeMinutes * microMinutesPerMinute + fraction;
+
     return true;
 }
 
+// Formats an unsigned coordinate with the minutes rounded to the given number of decimal places,
+// carrying into the degrees when rounding reaches a full 60 minutes. This is also used for
+// coordinates that didn't come from NMEA text, such as those in AIS messages.
+void NMEACoordinate::format(etl::istring &coordinateStr, uint8_t degrees, uint32_t microMinutes,
+                            unsigned decimalPlaces, const char *degreesSeparator) {
+    uint32_t divisor = 1;
+    for (unsigned digit = decimalPlaces; digit < minutesDecimalDigits; digit++) {
+        divisor *= 10;
+    }
+    uint32_t scale = microMinutesPerMinute / divisor;
+    uint32_t scaledMinutes = (microMinutes + divisor / 2) / divisor;
+    unsigned wholeDegrees = degrees;
+    if (scaledMinutes >= 60 * scale) {
+        scaledMinutes -= 60 * scale;
+        wholeDegrees++;
+    }
+    const unsigned wholeMinutes = scaledMinutes / scale;
+    uint32_t fraction = scaledMinutes % scale;
+
+    char digits[3];
+    unsigned digitCount = 0;
+    do {
+        digits[digitCount++] = '0' + wholeDegrees % 10;
+        wholeDegrees /= 10;
+    } while (wholeDegrees && digitCount < sizeof(digits));
+    while (digitCount) {
+        coordinateStr += digits[--digitCount];
+    }
+
+    coordinateStr += "\xC2\xB0";
+    coordinateStr += degreesSeparator;
+
+    if (wholeMinutes >= 10) {
+        coordinateStr += (char)('0' + wholeMinutes / 10);
+    }
+    coordinateStr += (char)('0' + wholeMinutes % 10);
+
+    if (decimalPlaces) {
+        coordinateStr += '.';
+        for (uint32_t place = scale / 10; place; place /= 10) {
+            coordinateStr += (char)('0' + fraction / place);
+            fraction %= place;
+        }
+    }
+
+    coordinateStr += '\'';
+}
+
 // This prints the coordinate as unsigned and the caller is responsible for appending N/S or E/W.
 void NMEACoordinate::log(Logger &logger) const {
     etl::string<20> coordinateStr;
-    etl::string_stream coordinateStream(coordinateStr);
 
-    coordinateStream << degrees << "\xC2\xB0" << etl::setprecision(5) << minutes << "'";
+    format(coordinateStr, degrees, microMinutes, 5, "");
 
     logger << coordinateStr;
 }
 
 void NMEACoordinate::publish(DataModelStringLeaf &leaf, const char *suffix) const {
     etl::string<coordinateLength> coordinateStr;
-    etl::string_stream coordinateStream(coordinateStr);
 
-    coordinateStream << degrees << "\xC2\xB0 " << etl::setprecision(4) << minutes << "' " << suffix;
+    format(coordinateStr, degrees, microMinutes, 4, " ");
+    coordinateStr += ' ';
+    coordinateStr += suffix;
 
     leaf = coordinateStr;
 }
@@ -21,22 +21,33 @@
 
 #include "DataModel/DataModelStringLeaf.h"
 
+#include <etl/string.h>
 #include <etl/string_view.h>
 
 #include <stdint.h>
 
 class Logger;
 
+// Coordinates are held as whole degrees plus minutes in millionths of a minute so that the
+// parse and format path never touches floating point, which is software emulated on the
+// SAMD21. A millionth of a minute is under 2mm, finer than any NMEA source reports.
 class NMEACoordinate {
+    private:
+        static constexpr uint32_t microMinutesPerMinute = 1000000;
+        static constexpr unsigned minutesDecimalDigits = 6;
+
     protected:
         uint8_t degrees;
-        float minutes;
+        uint32_t microMinutes;
 
         bool setDegrees(const etl::string_view &degreesView, uint8_t maxDegrees);
         bool setMinutes(const etl::string_view &minutesView);
         void log(Logger &logger) const;
-        void snprint(char *string, size_t maxLength) const;
         void publish(DataModelStringLeaf &leaf, const char *suffix) const;
+
+    public:
+        static void format(etl::istring &coordinateStr, uint8_t degrees, uint32_t microMinutes,
+                           unsigned decimalPlaces, const char *degreesSeparator);
 };
 
 #endif
@@ -21,6 +21,7 @@
 #include "Config.h"
 
 #include "Util/Logger.h"
+#include "Util/UTCTimestamp.h"
 
 #include <etl/string.h>
 #include <etl/string_view.h>
@@ -28,6 +29,7 @@
 #include <etl/to_arithmetic.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 bool NMEADate::set(const etl::string_view &dateView) {
     const size_t length = dateView.size();
@@ -82,13 +84,13 @@ bool NMEADate::set(const etl::string_view &dateView) {
 bool NMEADate::extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType) {
     etl::string_view dateView;
     if (!nmeaLine.getWord(dateView)) {
-        logger << logWarning << talker << " " << msgType << " message missing Date field" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message missing Date field" << eol;
         return false;
     }
 
     if (!set(dateView)) {
-        logger << logWarning << talker << " " << msgType << " message with bad Date field '"
-               << dateView << "'" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message with bad Date field '"
+                        << dateView << "'" << eol;
         return false;
     }
 
@@ -108,6 +110,17 @@ void NMEADate::publish(DataModelStringLeaf &leaf) const {
     }
 }
 
+// Gives the date as days since the UTCTimestamp epoch, returning false if there wasn't a date in
+// the sentence or it can't be placed on the calendar.
+bool NMEADate::daysSinceEpoch(uint32_t &days) const {
+    if (!hasValue || month == 0 || day == 0) {
+        return false;
+    }
+
+    days = UTCTimestamp::daysSinceEpoch(year, month, day);
+    return true;
+}
+
 void NMEADate::log(Logger &logger) const {
     if (hasValue) {
         logger << month / 10 << month % 10 << "/" << day / 10 << day % 10 << "/" << year;
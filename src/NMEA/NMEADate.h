@@ -30,6 +30,7 @@
 #include <etl/string_view.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 class NMEADate : public LoggableItem {
     private:
@@ -43,6 +44,7 @@ class NMEADate : public LoggableItem {
     public:
         bool extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType);
         void publish(DataModelStringLeaf &leaf) const;
+        bool daysSinceEpoch(uint32_t &days) const;
         virtual void log(Logger &logger) const override;
 };
 
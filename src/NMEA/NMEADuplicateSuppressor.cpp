@@ -0,0 +1,133 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NMEADuplicateSuppressor.h"
+
+#include "DataModel/DataModelLeaf.h"
+
+#include "StatsManager/StatsManager.h"
+
+#include "Util/Error.h"
+
+#include <Arduino.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+NMEADuplicateSuppressor::NMEADuplicateSuppressor(StatsManager &statsManager)
+    : sources(), windowMs(defaultWindowMs), policy(FIRST_ARRIVAL_WINS),
+      preferredSourceIndex(noSource), nextSequence(0) {
+    for (Entry &entry : table) {
+        entry.key = 0;
+        entry.timeMs = 0;
+        entry.sequence = 0;
+        entry.sourceIndex = noSource;
+    }
+
+    statsManager.addStatsHolder(this);
+}
+
+// Returns the index the source should identify itself with in isDuplicate calls.
+uint8_t NMEADuplicateSuppressor::addSource(DataModelLeaf &duplicatesDataModelLeaf) {
+    if (sources.full()) {
+        fatalError("Too many sources for NMEA duplicate suppressor");
+    }
+
+    sources.push_back({ 0, &duplicatesDataModelLeaf });
+    return sources.size() - 1;
+}
+
+void NMEADuplicateSuppressor::setWindow(uint32_t milliSeconds) {
+    windowMs = milliSeconds;
+}
+
+void NMEADuplicateSuppressor::setPolicy(Policy policy, uint8_t preferredSourceIndex) {
+    if (policy == PREFERRED_SOURCE_WINS && preferredSourceIndex >= sources.size()) {
+        fatalError("Bad preferred source for NMEA duplicate suppressor");
+    }
+
+    this->policy = policy;
+    this->preferredSourceIndex = preferredSourceIndex;
+}
+
+// FNV-1a over the tag, followed by the length and XOR. The XOR is of the entire line, so two lines
+// with the same key differ, if at all, in characters that cancel out, which within the window is
+// rare enough not to matter.
+uint32_t NMEADuplicateSuppressor::lineKey(const char *tagChars, size_t lineLength,
+                                          uint8_t lineXOR) {
+    uint32_t key = 2166136261u;
+    for (size_t tagPos = 0; tagPos < 5; tagPos++) {
+        key = (key ^ (uint8_t)tagChars[tagPos]) * 16777619u;
+    }
+    key = (key ^ (uint8_t)lineLength) * 16777619u;
+    key = (key ^ lineXOR) * 16777619u;
+
+    return key;
+}
+
+bool NMEADuplicateSuppressor::isDuplicate(uint8_t sourceIndex, const char *tagChars,
+                                          size_t lineLength, uint8_t lineXOR) {
+    const uint32_t key = lineKey(tagChars, lineLength, lineXOR);
+    const uint32_t now = millis();
+
+    Entry *replaceEntry = NULL;
+    bool replaceIsCurrent = false;
+    for (size_t probe = 0; probe < maxProbes; probe++) {
+        Entry &entry = table[(key + probe) & tableMask];
+        const bool current = entry.sourceIndex != noSource && now - entry.timeMs < windowMs;
+        if (current && entry.key == key) {
+            if (entry.sourceIndex == sourceIndex ||
+                (policy == PREFERRED_SOURCE_WINS && sourceIndex == preferredSourceIndex)) {
+                // Either the source is repeating itself, which isn't ours to judge, or it's the
+                // preferred source taking the line over.
+                entry.timeMs = now;
+                entry.sourceIndex = sourceIndex;
+                return false;
+            }
+
+            sources[sourceIndex].duplicates++;
+            return true;
+        }
+
+        // Prefer reusing an unused or aged out slot, otherwise take the oldest one probed.
+        if (!current) {
+            if (replaceEntry == NULL || replaceIsCurrent) {
+                replaceEntry = &entry;
+                replaceIsCurrent = false;
+            }
+        } else if (replaceEntry == NULL ||
+                   (replaceIsCurrent && (uint16_t)(nextSequence - entry.sequence) >
+                                         (uint16_t)(nextSequence - replaceEntry->sequence))) {
+            replaceEntry = &entry;
+            replaceIsCurrent = true;
+        }
+    }
+
+    replaceEntry->key = key;
+    replaceEntry->timeMs = now;
+    replaceEntry->sequence = nextSequence++;
+    replaceEntry->sourceIndex = sourceIndex;
+
+    return false;
+}
+
+void NMEADuplicateSuppressor::exportStats(__attribute__((unused)) uint32_t msElapsed) {
+    for (const Source &source : sources) {
+        *source.duplicatesDataModelLeaf << source.duplicates;
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NMEA_DUPLICATE_SUPPRESSOR_H
+#define NMEA_DUPLICATE_SUPPRESSOR_H
+
+class DataModelLeaf;
+class StatsManager;
+
+#include "StatsManager/StatsHolder.h"
+
+#include <etl/vector.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Shared between NMEASources that may be carrying the same instruments, such as a USB connection
+// and a WiFi bridge from the same NMEA network. Each framed line is reduced to a key made from its
+// tag, length and XOR, and a line whose key was seen from a different source within the time
+// window is dropped before it's checked or parsed. The key table is small and fixed, with entries
+// aging out by time rather than being removed.
+//
+// With the first arrival policy whichever source delivers a line first wins. With the preferred
+// source policy the preferred source's lines are never dropped, while the other sources' lines
+// are dropped when they repeat a recent line. Counts of dropped lines are kept per source.
+class NMEADuplicateSuppressor : public StatsHolder {
+    public:
+        enum Policy {
+            FIRST_ARRIVAL_WINS,
+            PREFERRED_SOURCE_WINS
+        };
+
+    private:
+        struct Entry {
+            uint32_t key;
+            uint32_t timeMs;
+            // Lines arrive faster than the millisecond clock ticks, so age for the purposes of
+            // replacement is by order of insertion.
+            uint16_t sequence;
+            uint8_t sourceIndex;
+        };
+
+        struct Source {
+            uint32_t duplicates;
+            DataModelLeaf *duplicatesDataModelLeaf;
+        };
+
+        // Must be a power of two.
+        static const size_t tableSize = 32;
+        static const size_t tableMask = tableSize - 1;
+        static const size_t maxProbes = 4;
+        static const uint32_t defaultWindowMs = 500;
+        static const size_t maxSources = 4;
+        static const uint8_t noSource = 0xff;
+
+        Entry table[tableSize];
+        etl::vector<Source, maxSources> sources;
+        uint32_t windowMs;
+        Policy policy;
+        uint8_t preferredSourceIndex;
+        uint16_t nextSequence;
+
+        static uint32_t lineKey(const char *tagChars, size_t lineLength, uint8_t lineXOR);
+
+    public:
+        NMEADuplicateSuppressor(StatsManager &statsManager);
+        uint8_t addSource(DataModelLeaf &duplicatesDataModelLeaf);
+        void setWindow(uint32_t milliSeconds);
+        void setPolicy(Policy policy, uint8_t preferredSourceIndex = noSource);
+        bool isDuplicate(uint8_t sourceIndex, const char *tagChars, size_t lineLength,
+                         uint8_t lineXOR);
+        virtual void exportStats(uint32_t msElapsed) override;
+};
+
+#endif
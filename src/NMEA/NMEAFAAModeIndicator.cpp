@@ -92,9 +92,9 @@ bool NMEAFAAModeIndicator::extract(NMEALine &nmeaLine, NMEATalker &talker, const
     etl::string_view faaModeIndicatorView;
     if (nmeaLine.getWord(faaModeIndicatorView)) {
         if (!set(faaModeIndicatorView)) {
-            logger << logWarning << talker << " " << msgType
-                   << " message with bad FAA Mode Indicator field '" << faaModeIndicatorView << "'"
-                   << eol;
+            LOG(logWarning) << talker << " " << msgType
+                            << " message with bad FAA Mode Indicator field '"
+                            << faaModeIndicatorView << "'" << eol;
             return false;
         }
     }
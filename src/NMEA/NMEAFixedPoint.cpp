@@ -0,0 +1,109 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NMEAFixedPoint.h"
+
+#include "Util/CharacterTools.h"
+
+#include <etl/string_view.h>
+
+#include <Arduino.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+bool nmeaParseFixedPoint(const etl::string_view &valueView, bool allowNegative, unsigned scale,
+                         uint32_t wholeLimit, uint32_t &wholeNumber, uint32_t &fraction,
+                         bool &negative) {
+    const char *pos = valueView.begin();
+    const char *end = valueView.end();
+
+    negative = false;
+    if (pos != end && *pos == '-') {
+        if (!allowNegative) {
+            return false;
+        }
+        negative = true;
+        pos++;
+    }
+
+    // Whole numbers are limited to 16 bits, so the accumulated value stays well clear of
+    // overflowing as each group of digits is added.
+    const char *wholeStart = pos;
+    uint32_t whole = 0;
+    uint16_t fourDigits;
+    while (end - pos >= 4 && fourDecimalDigitsValue(pos, fourDigits)) {
+        whole = whole * 10000 + fourDigits;
+        if (whole > wholeLimit) {
+            return false;
+        }
+        pos += 4;
+    }
+    for (; pos != end && *pos != '.'; pos++) {
+        if (!isDigit(*pos)) {
+            return false;
+        }
+        whole = whole * 10 + decimalValue(*pos);
+        if (whole > wholeLimit) {
+            return false;
+        }
+    }
+    if (pos == wholeStart) {
+        return false;
+    }
+
+    uint32_t scaledFraction = 0;
+    unsigned fractionDigits = 0;
+    bool roundUp = false;
+    if (pos != end) {
+        if (scale == 0) {
+            return false;
+        }
+        for (pos++; pos != end; pos++) {
+            if (!isDigit(*pos)) {
+                return false;
+            }
+            if (fractionDigits < scale) {
+                scaledFraction = scaledFraction * 10 + decimalValue(*pos);
+                fractionDigits++;
+            } else if (fractionDigits == scale) {
+                roundUp = *pos >= '5';
+                fractionDigits++;
+            }
+        }
+    }
+
+    for (; fractionDigits < scale; fractionDigits++) {
+        scaledFraction *= 10;
+    }
+
+    if (roundUp) {
+        scaledFraction++;
+        if (scaledFraction == nmeaPowerOfTen(scale)) {
+            scaledFraction = 0;
+            whole++;
+            if (whole > wholeLimit) {
+                return false;
+            }
+        }
+    }
+
+    wholeNumber = whole;
+    fraction = scaledFraction;
+    return true;
+}
@@ -0,0 +1,192 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NMEA_FIXED_POINT_H
+#define NMEA_FIXED_POINT_H
+
+#include "NMEALine.h"
+#include "NMEATalker.h"
+#include "NMEALazyField.h"
+
+#include "DataModel/DataModelUInt8Leaf.h"
+#include "DataModel/DataModelInt8Leaf.h"
+#include "DataModel/DataModelUInt16Leaf.h"
+#include "DataModel/DataModelTenthsUInt16Leaf.h"
+#include "DataModel/DataModelTenthsInt16Leaf.h"
+#include "DataModel/DataModelHundredthsUInt8Leaf.h"
+#include "DataModel/DataModelHundredthsUInt16Leaf.h"
+
+#include "Util/Logger.h"
+#include "Util/Error.h"
+
+#include <etl/string_view.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Converts an NMEA decimal number to a whole number and a fraction with the given number of
+// decimal places, rounding on the first digit dropped, in a single pass over the text. The whole
+// number, before any rounding carry, can't exceed wholeLimit. Numbers with a fractional part are
+// rejected when scale is zero.
+extern bool nmeaParseFixedPoint(const etl::string_view &valueView, bool allowNegative,
+                                unsigned scale, uint32_t wholeLimit, uint32_t &wholeNumber,
+                                uint32_t &fraction, bool &negative);
+
+constexpr uint32_t nmeaPowerOfTen(unsigned exponent) {
+    return exponent == 0 ? 1 : 10 * nmeaPowerOfTen(exponent - 1);
+}
+
+// A fixed point NMEA number field, with a whole number of type Whole and Scale decimal places.
+// The limits of the type are worked out at compile time, and the whole number types are kept
+// small enough that the parse can't overflow.
+template <typename Whole, unsigned Scale>
+class NMEAFixedPoint : public NMEALazyField {
+    private:
+        static_assert(sizeof(Whole) <= 2, "NMEA fixed point whole numbers are limited to 16 bits");
+        static_assert(Scale <= 2, "NMEA fixed point numbers are limited to two decimal places");
+
+        static constexpr bool isSigned = (Whole)-1 < (Whole)0;
+        static constexpr int32_t typeMax =
+            isSigned ? (1L << (sizeof(Whole) * 8 - 1)) - 1 : (1L << (sizeof(Whole) * 8)) - 1;
+        static constexpr int32_t typeMin = isSigned ? -typeMax - 1 : 0;
+        static constexpr uint32_t fractionDivisor = nmeaPowerOfTen(Scale);
+
+        // Selects between publishing a whole number and a whole number with a fraction.
+        template <bool wholeNumberOnly>
+        struct LeafKind {
+        };
+
+        Whole wholeNumber;
+        uint8_t fraction;
+        // Kept apart from the whole number, which loses the sign of values between 0 and -1.
+        bool negative;
+        Whole minValue;
+        Whole maxValue;
+
+        virtual bool convert(const etl::string_view &valueView) override {
+            uint32_t parsedWholeNumber;
+            uint32_t parsedFraction;
+            bool negative;
+            if (!nmeaParseFixedPoint(valueView, isSigned, Scale, -typeMin > typeMax ? -typeMin
+                                                                                   : typeMax,
+                                     parsedWholeNumber, parsedFraction, negative)) {
+                return false;
+            }
+
+            const int32_t value = negative ? -(int32_t)parsedWholeNumber
+                                           : (int32_t)parsedWholeNumber;
+            if (value < minValue || value > maxValue) {
+                return false;
+            }
+
+            wholeNumber = value;
+            fraction = parsedFraction;
+            this->negative = negative;
+            return true;
+        }
+
+        template <typename Leaf>
+        void setLeaf(Leaf &leaf, LeafKind<true>) const {
+            leaf = wholeNumber;
+        }
+
+        template <typename Leaf>
+        void setLeaf(Leaf &leaf, LeafKind<false>) const {
+            setFractionLeaf(leaf);
+        }
+
+        template <typename Leaf>
+        void setFractionLeaf(Leaf &leaf) const {
+            leaf.set(wholeNumber, fraction);
+        }
+
+        // Signed leaves take a single count of tenths.
+        void setFractionLeaf(DataModelTenthsInt16Leaf &leaf) const {
+            const int32_t magnitude = (negative ? -(int32_t)wholeNumber : wholeNumber) *
+                                      (int32_t)fractionDivisor + fraction;
+            leaf.set(negative ? -magnitude : magnitude);
+        }
+
+    public:
+        bool extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType,
+                     const char *fieldName, bool optional = false, Whole maxValue = typeMax) {
+            return extract(nmeaLine, talker, msgType, fieldName, optional, typeMin, maxValue);
+        }
+
+        bool extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType,
+                     const char *fieldName, bool optional, Whole minValue, Whole maxValue) {
+            this->minValue = minValue;
+            this->maxValue = maxValue;
+            return extractField(nmeaLine, talker, msgType, fieldName, optional);
+        }
+
+        Whole getValue() const {
+            if (!converted()) {
+                fatalError("Attempt to read value from NMEA number with value not present");
+            }
+
+            return wholeNumber;
+        }
+
+        uint8_t getFraction() const {
+            if (!converted()) {
+                fatalError("Attempt to read fraction from NMEA number with value not present");
+            }
+
+            return fraction;
+        }
+
+        template <typename Leaf>
+        void publish(Leaf &leaf) const {
+            if (converted()) {
+                setLeaf(leaf, LeafKind<Scale == 0>());
+            } else {
+                leaf.removeValue();
+            }
+        }
+
+        virtual void log(Logger &logger) const override {
+            if (!converted()) {
+                logger << "NA";
+                return;
+            }
+
+            if (negative && wholeNumber == 0) {
+                logger << "-";
+            }
+            logger << wholeNumber;
+            if (Scale) {
+                logger << ".";
+                for (uint32_t placeValue = fractionDivisor / 10; placeValue > 1 &&
+                     fraction < placeValue; placeValue /= 10) {
+                    logger << "0";
+                }
+                logger << fraction;
+            }
+        }
+};
+
+typedef NMEAFixedPoint<uint8_t, 0> NMEAUInt8;
+typedef NMEAFixedPoint<int8_t, 0> NMEAInt8;
+typedef NMEAFixedPoint<uint16_t, 0> NMEAUInt16;
+typedef NMEAFixedPoint<uint16_t, 1> NMEATenthsUInt16;
+typedef NMEAFixedPoint<int16_t, 1> NMEATenthsInt16;
+typedef NMEAFixedPoint<uint8_t, 2> NMEAHundredthsUInt8;
+typedef NMEAFixedPoint<uint16_t, 2> NMEAHundredthsUInt16;
+
+#endif
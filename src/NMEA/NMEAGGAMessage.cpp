@@ -21,8 +21,7 @@
 #include "NMEADataValid.h"
 #include "NMEALatitude.h"
 #include "NMEALongitude.h"
-#include "NMEAHundredthsUInt16.h"
-#include "NMEATenthsInt16.h"
+#include "NMEAFixedPoint.h"
 #include "NMEATalker.h"
 #include "NMEALine.h"
 #include "NMEAMessageBuffer.h"
@@ -36,7 +35,7 @@ NMEAGGAMessage::NMEAGGAMessage(NMEATalker &talker) : NMEAMessage(talker) {
 
 bool NMEAGGAMessage::parse(NMEALine &nmeaLine) {
     if (nmeaLine.isEncapsulatedData()) {
-        logger << logWarning << talker << " GGA message in unsupported encapsulated format" << eol;
+        LOG(logWarning) << talker << " GGA message in unsupported encapsulated format" << eol;
         return false;
     }
 
@@ -25,10 +25,7 @@
 #include "NMEALatitude.h"
 #include "NMEALongitude.h"
 #include "NMEAGPSQuality.h"
-#include "NMEAHundredthsUInt16.h"
-#include "NMEATenthsInt16.h"
-#include "NMEATenthsUInt16.h"
-#include "NMEAUInt16.h"
+#include "NMEAFixedPoint.h"
 #include "NMEATalker.h"
 #include "NMEALine.h"
 
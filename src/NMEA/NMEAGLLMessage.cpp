@@ -36,7 +36,7 @@ NMEAGLLMessage::NMEAGLLMessage(NMEATalker &talker) : NMEAMessage(talker) {
 
 bool NMEAGLLMessage::parse(NMEALine &nmeaLine) {
     if (nmeaLine.isEncapsulatedData()) {
-        logger << logWarning << talker << " GLL message in unsupported encapsulated format" << eol;
+        LOG(logWarning) << talker << " GLL message in unsupported encapsulated format" << eol;
         return false;
     }
 
@@ -47,14 +47,14 @@ bool NMEAGPSFixMode::set(etl::string_view &gpsFixModeView) {
 bool NMEAGPSFixMode::extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType) {
     etl::string_view gpsFixModeView;
     if (!nmeaLine.getWord(gpsFixModeView)) {
-        logger << logWarning << talker << " " << msgType << " message missing GPS Fix Mode field"
-               << eol;
+        LOG(logWarning) << talker << " " << msgType << " message missing GPS Fix Mode field"
+                        << eol;
         return false;
     }
 
     if (!set(gpsFixModeView)) {
-        logger << logWarning << talker << " " << msgType << " message with bad GPS Fix Mode field '"
-               << gpsFixModeView << "'" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message with bad GPS Fix Mode field '"
+                        << gpsFixModeView << "'" << eol;
         return false;
     }
 
@@ -47,14 +47,14 @@ bool NMEAGPSQuality::set(etl::string_view &gpsQualityView) {
 bool NMEAGPSQuality::extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType) {
     etl::string_view gpsQualityView;
     if (!nmeaLine.getWord(gpsQualityView)) {
-        logger << logWarning << talker << " " << msgType << " message missing GPS Quality field"
-               << eol;
+        LOG(logWarning) << talker << " " << msgType << " message missing GPS Quality field"
+                        << eol;
         return false;
     }
 
     if (!set(gpsQualityView)) {
-        logger << logWarning << talker << " " << msgType << " message with bad GPS Quality field '"
-               << gpsQualityView << "'" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message with bad GPS Quality field '"
+                        << gpsQualityView << "'" << eol;
         return false;
     }
 
@@ -33,14 +33,14 @@ NMEAGSAMessage::NMEAGSAMessage(NMEATalker &talker) : NMEAMessage(talker) {
 
 bool NMEAGSAMessage::parse(NMEALine &nmeaLine) {
     if (nmeaLine.isEncapsulatedData()) {
-        logger << logWarning << talker << " GSA message in unsupported encapsulated format" << eol;
+        LOG(logWarning) << talker << " GSA message in unsupported encapsulated format" << eol;
         return false;
     }
 
     etl::string_view manualOrAutomaticModeView;
     if (!nmeaLine.getWord(manualOrAutomaticModeView)) {
-        logger << logWarning << talker << " GSA message missing Manual or Automatic Mode indicator"
-               << eol;
+        LOG(logWarning) << talker << " GSA message missing Manual or Automatic Mode indicator"
+                        << eol;
         return false;
     }
     if (manualOrAutomaticModeView.size() == 1) {
@@ -52,13 +52,14 @@ bool NMEAGSAMessage::parse(NMEALine &nmeaLine) {
                 automaticMode = false;
                 break;
             default:
-                logger << logWarning << talker
-                       << " GSA message with bad Manual or Automatic Mode indicator" << eol;
+                LOG(logWarning) << talker
+                                << " GSA message with bad Manual or Automatic Mode indicator"
+                                << eol;
                 return false;
         }
     } else {
-        logger << logWarning << talker << " GSA message with bad Manual or Automatic Mode indicator"
-               << eol;
+        LOG(logWarning) << talker << " GSA message with bad Manual or Automatic Mode indicator"
+                        << eol;
         return false;
     }
 
@@ -21,8 +21,7 @@
 
 #include "NMEAMessage.h"
 #include "NMEAGPSFixMode.h"
-#include "NMEAUInt16.h"
-#include "NMEAHundredthsUInt8.h"
+#include "NMEAFixedPoint.h"
 #include "NMEATalker.h"
 #include "NMEALine.h"
 
@@ -20,7 +20,7 @@
 #include "NMEAMsgType.h"
 #include "NMEATalker.h"
 #include "NMEALine.h"
-#include "NMEAUInt8.h"
+#include "NMEAFixedPoint.h"
 #include "NMEAMessageBuffer.h"
 
 #include "Util/StringTools.h"
@@ -32,7 +32,7 @@ NMEAGSVMessage::NMEAGSVMessage(NMEATalker &talker) : NMEAMessage(talker) {
 
 bool NMEAGSVMessage::parse(NMEALine &nmeaLine) {
     if (nmeaLine.isEncapsulatedData()) {
-        logger << logWarning << talker << " GSV message in unsupported encapsulated format" << eol;
+        LOG(logWarning) << talker << " GSV message in unsupported encapsulated format" << eol;
         return false;
     }
 
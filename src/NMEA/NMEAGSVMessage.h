@@ -20,7 +20,7 @@
 #define NMEA_GSV_MESSAGE_H
 
 #include "NMEAMessage.h"
-#include "NMEAUInt8.h"
+#include "NMEAFixedPoint.h"
 #include "NMEAGSVSatelitteInfo.h"
 #include "NMEATalker.h"
 #include "NMEALine.h"
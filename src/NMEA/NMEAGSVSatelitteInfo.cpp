@@ -19,10 +19,7 @@
 #include "NMEAGSVSatelitteInfo.h"
 #include "NMEALine.h"
 #include "NMEATalker.h"
-#include "NMEAUInt16.h"
-#include "NMEAInt8.h"
-#include "NMEATenthsUInt16.h"
-#include "NMEAUInt8.h"
+#include "NMEAFixedPoint.h"
 
 #include "Util/Logger.h"
 
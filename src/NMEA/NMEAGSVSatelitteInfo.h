@@ -19,10 +19,7 @@
 #ifndef NMEA_GSV_SATELLITE_INFO_H
 #define NMEA_GSV_SATELLITE_INFO_H
 
-#include "NMEAUInt16.h"
-#include "NMEAInt8.h"
-#include "NMEATenthsUInt16.h"
-#include "NMEAUInt8.h"
+#include "NMEAFixedPoint.h"
 #include "NMEALine.h"
 
 #include "Util/LoggableItem.h"
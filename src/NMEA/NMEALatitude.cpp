@@ -62,19 +62,19 @@ bool NMEALatitude::set(const etl::string_view &latitudeView,
 bool NMEALatitude::extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType) {
     etl::string_view latitudeView;
     if (!nmeaLine.getWord(latitudeView)) {
-        logger << logWarning << talker << " " << msgType << " message missing latitude" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message missing latitude" << eol;
         return false;
     }
 
     etl::string_view northOrSouthView;
     if (!nmeaLine.getWord(northOrSouthView)) {
-        logger << logWarning << talker << " " << msgType << " message missing N/S" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message missing N/S" << eol;
         return false;
     }
 
     if (!set(latitudeView, northOrSouthView)) {
-        logger << logWarning << talker << " " << msgType << " message with bad latitude '"
-               << latitudeView << "' '" << northOrSouthView << "'" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message with bad latitude '"
+                        << latitudeView << "' '" << northOrSouthView << "'" << eol;
         return false;
     }
 
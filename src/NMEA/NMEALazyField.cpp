@@ -0,0 +1,85 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NMEALazyField.h"
+#include "NMEALine.h"
+#include "NMEATalker.h"
+
+#include "Util/Logger.h"
+
+#include <etl/string_view.h>
+
+NMEALazyField::NMEALazyField() : valueView(), fieldName(NULL), state(FIELD_ABSENT) {
+}
+
+bool NMEALazyField::extractField(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType,
+                                 const char *fieldName, bool optional) {
+    etl::string_view valueView;
+    if (!nmeaLine.getWord(valueView)) {
+        if (!optional) {
+            LOG(logWarning) << talker << " " << msgType << " message missing " << fieldName
+                            << " field" << eol;
+            state = FIELD_ABSENT;
+            return false;
+        }
+
+        state = FIELD_ABSENT;
+        return true;
+    }
+
+    return setField(valueView, talker, msgType, fieldName, optional);
+}
+
+// Only the presence of the field is checked here, the conversion waits until the value is needed.
+bool NMEALazyField::setField(const etl::string_view &valueView, NMEATalker &talker,
+                             const char *msgType, const char *fieldName, bool optional) {
+    if (valueView.empty()) {
+        state = FIELD_ABSENT;
+        if (!optional) {
+            LOG(logWarning) << talker << " " << msgType << " message with empty "
+                            << fieldName << " field" << eol;
+            return false;
+        }
+        return true;
+    }
+
+    this->valueView = valueView;
+    this->fieldName = fieldName;
+    state = FIELD_UNCONVERTED;
+
+    return true;
+}
+
+bool NMEALazyField::converted() const {
+    if (state == FIELD_UNCONVERTED) {
+        // The conversion only sets the value, which the const accessors treat as a cache.
+        if (const_cast<NMEALazyField *>(this)->convert(valueView)) {
+            state = FIELD_VALID;
+        } else {
+            LOG(logWarning) << "NMEA message with bad " << fieldName << " field '"
+                            << valueView << "'" << eol;
+            state = FIELD_INVALID;
+        }
+    }
+
+    return state == FIELD_VALID;
+}
+
+bool NMEALazyField::hasValue() const {
+    return converted();
+}
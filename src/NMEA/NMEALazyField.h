@@ -0,0 +1,63 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NMEA_LAZY_FIELD_H
+#define NMEA_LAZY_FIELD_H
+
+#include "NMEALine.h"
+#include "NMEATalker.h"
+
+#include "Util/LoggableItem.h"
+
+#include <etl/string_view.h>
+
+#include <stdint.h>
+
+// Base for NMEA fields whose text is only converted to a value when it's first used. Extracting
+// the field just records where it is in the line, so fields that are never published or logged
+// never have their conversion done. Since the field refers to the line, it can only be used while
+// the message is being processed.
+//
+// A field that fails conversion is logged and then treated as if it had no value.
+class NMEALazyField : public LoggableItem {
+    private:
+        enum State : uint8_t {
+            FIELD_ABSENT,
+            FIELD_UNCONVERTED,
+            FIELD_VALID,
+            FIELD_INVALID
+        };
+
+        etl::string_view valueView;
+        const char *fieldName;
+        mutable State state;
+
+    protected:
+        bool extractField(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType,
+                          const char *fieldName, bool optional);
+        bool converted() const;
+        virtual bool convert(const etl::string_view &valueView) = 0;
+
+    public:
+        NMEALazyField();
+        bool setField(const etl::string_view &valueView, NMEATalker &talker, const char *msgType,
+                      const char *fieldName, bool optional);
+        bool hasValue() const;
+};
+
+#endif
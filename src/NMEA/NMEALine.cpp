@@ -21,22 +21,19 @@
 #include "Util/CharacterTools.h"
 #include "Util/Logger.h"
 
-#include <etl/string.h>
 #include <etl/string_view.h>
 
 #include <stddef.h>
 
-NMEALine::NMEALine() : line(), remaining(){
+NMEALine::NMEALine()
+    : line(), fieldCount(0), nextField(0), lineXOR(0), encapsulatedData(false) {
 }
 
-void NMEALine::reset() {
-    line.clear();
-    remaining = line;
-}
-
-void NMEALine::append(const char *srcBuffer, size_t start, size_t end) {
-    line.append(srcBuffer + start, end - start);
-    remaining = line;
+void NMEALine::set(const char *lineStart, size_t length, uint8_t lineXOR) {
+    line.assign(lineStart, length);
+    fieldCount = 0;
+    nextField = 0;
+    this->lineXOR = lineXOR;
 }
 
 bool NMEALine::isEmpty() {
@@ -48,14 +45,12 @@ bool NMEALine::isEncapsulatedData() {
 }
 
 bool NMEALine::sanityCheck() {
-    char msgStart;
-
-    if (!extractChar(msgStart)) {
-        logger << logWarning << "Empty NMEA message" << eol;
+    if (line.empty()) {
+        LOG(logWarning) << "Empty NMEA message" << eol;
         return false;
     }
 
-    switch (msgStart) {
+    switch (line.front()) {
         case '$':
             encapsulatedData = false;
             break;
@@ -65,79 +60,92 @@ bool NMEALine::sanityCheck() {
             break;
 
         default:
-            logger << logWarning << "NMEA message missing leading '$'" << eol;
+            LOG(logWarning) << "NMEA message missing leading '$'" << eol;
             logLine();
             return false;
     }
 
     if (!checkParity()) {
-        logger << logWarning << "NMEA line with bad parity: " << line << eol;
+        LOG(logWarning) << "NMEA line with bad parity: " << line << eol;
+        return false;
+    }
+
+    if (!indexFields()) {
+        LOG(logWarning) << "NMEA line with more than " << (uint32_t)maxNMEAFields
+                        << " fields: " << line << eol;
         return false;
     }
-    stripParity();
 
     return true;
 }
 
-bool NMEALine::extractChar(char &character) {
-    if (remaining.empty()) {
-        return false;
+// Records the start and length of each of the comma separated fields between the leading '$' or
+// '!' and the checksum, in a single pass over the line. The tag is field zero.
+bool NMEALine::indexFields() {
+    const size_t bodyEnd = line.size() - 3;
+    size_t fieldStart = 1;
+    fieldCount = 0;
+    for (size_t pos = 1; pos <= bodyEnd; pos++) {
+        if (pos == bodyEnd || line[pos] == ',') {
+            if (fieldCount == maxNMEAFields) {
+                return false;
+            }
+            fieldStarts[fieldCount] = fieldStart;
+            fieldLengths[fieldCount] = pos - fieldStart;
+            fieldCount++;
+            fieldStart = pos + 1;
+        }
     }
-
-    character = remaining.front();
-    remaining.remove_prefix(1);
+    nextField = 0;
 
     return true;
 }
 
 bool NMEALine::getWord(etl::string_view &word) {
-    if (remaining.empty()) {
+    if (!getField(nextField, word)) {
         return false;
     }
+    nextField++;
+
+    return true;
+}
 
-    size_t commaPos = remaining.find(',');
-    if (commaPos == remaining.npos) {
-        word.assign(remaining.begin(), remaining.end());
-        remaining.remove_prefix(remaining.size());
-    } else {
-        word.assign(remaining.begin(), remaining.begin() + commaPos);
-        remaining.remove_prefix(commaPos + 1);
+bool NMEALine::getField(size_t fieldIndex, etl::string_view &field) const {
+    if (fieldIndex >= fieldCount) {
+        return false;
     }
 
+    field.assign(line.data() + fieldStarts[fieldIndex], fieldLengths[fieldIndex]);
+
     return true;
 }
 
 bool NMEALine::atEndOfLine() {
-    return remaining.empty();
-}
-
-void NMEALine::stripParity() {
-    remaining.remove_suffix(3);
+    return nextField == fieldCount;
 }
 
+// The checksum covers everything between the leading '$' or '!' and the '*'. Since we already have
+// the XOR of the whole line, the XOR of the checksummed part is found by backing out the other four
+// characters. Rather than decoding the line's checksum, the expected one is encoded and compared,
+// which also takes care of making sure that it's two upper case hex digits.
 bool NMEALine::checkParity() {
-    size_t checksumPos = line.size() - 3;
-    if (line[checksumPos] != '*') {
+    if (line.size() < 4) {
         return false;
     }
 
-    uint8_t checksum = 0;
-    for (size_t pos = 1; pos < checksumPos; pos++) {
-        checksum = checksum ^ line[pos];
-    }
-
-    const uint8_t firstChecksumChar = line[checksumPos + 1];
-    const uint8_t secondChecksumChar = line[checksumPos + 2];
-    if (!isUpperCaseHexidecimalDigit(firstChecksumChar) ||
-        !isUpperCaseHexidecimalDigit(secondChecksumChar)) {
+    const size_t checksumPos = line.size() - 3;
+    if (line[checksumPos] != '*') {
         return false;
     }
-    const uint8_t lineChecksum = hexidecimalValue(firstChecksumChar) * 16 +
-                                 hexidecimalValue(secondChecksumChar);
 
-    return lineChecksum == checksum;
+    const char firstChecksumChar = line[checksumPos + 1];
+    const char secondChecksumChar = line[checksumPos + 2];
+    const uint8_t checksum = lineXOR ^ line[0] ^ '*' ^ firstChecksumChar ^ secondChecksumChar;
+
+    return firstChecksumChar == upperCaseHexidecimalDigit(checksum >> 4) &&
+           secondChecksumChar == upperCaseHexidecimalDigit(checksum & 0xf);
 }
 
 void NMEALine::logLine() {
-    logger << logDebugNMEA << line << eol;
+    LOG(logDebugNMEA) << line << eol;
 }
\ No newline at end of file
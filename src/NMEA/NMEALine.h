@@ -19,33 +19,43 @@
 #ifndef NMEA_LINE_H
 #define NMEA_LINE_H
 
-#include <etl/string.h>
 #include <etl/string_view.h>
 
+#include <stdint.h>
 #include <stddef.h>
 
 const size_t maxNMEALineLength = 82;
+// More fields than any sentence we parse has. Lines with more are rejected by the sanity check.
+const size_t maxNMEAFields = 32;
 
+// A line of NMEA input, without its CR/LF. The line isn't copied, it's a view into the buffer it
+// was received into, and so is only good until that buffer is next written. Once the line has
+// passed its sanity check, the comma separated fields of the line have been indexed so that they
+// can be handed out as views without searching the line again.
 class NMEALine {
     private:
-        etl::string<maxNMEALineLength> line;
-        etl::string_view remaining;
+        etl::string_view line;
+        uint8_t fieldStarts[maxNMEAFields];
+        uint8_t fieldLengths[maxNMEAFields];
+        uint8_t fieldCount;
+        uint8_t nextField;
+        // XOR of every character in the line, computed while it was being framed.
+        uint8_t lineXOR;
         // This flag is used to indentify the lines which are in the encapsulated encoding scheme
         // used for AIS messages (and possibly others), versus the normal style NMEA 0183 CSV data.
         bool encapsulatedData;
 
-        void stripParity();
         bool checkParity();
+        bool indexFields();
 
     public:
         NMEALine();
-        void reset();
-        void append(const char *srcBuffer, size_t start, size_t end);
+        void set(const char *lineStart, size_t length, uint8_t lineXOR);
         bool isEmpty();
         bool isEncapsulatedData();
         bool sanityCheck();
-        bool extractChar(char &character);
         bool getWord(etl::string_view &word);
+        bool getField(size_t fieldIndex, etl::string_view &field) const;
         bool atEndOfLine();
         void logLine();
 };
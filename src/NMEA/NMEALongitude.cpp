@@ -60,19 +60,19 @@ bool NMEALongitude::set(const etl::string_view &longitudeView,
 bool NMEALongitude::extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType) {
     etl::string_view longitudeView;
     if (!nmeaLine.getWord(longitudeView)) {
-        logger << logWarning << talker << " " << msgType << " message missing longitude" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message missing longitude" << eol;
         return false;
     }
 
     etl::string_view eastOrWestView;
     if (!nmeaLine.getWord(eastOrWestView)) {
-        logger << logWarning << talker << " " << msgType << " message missing E/W" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message missing E/W" << eol;
         return false;
     }
 
     if (!set(longitudeView, eastOrWestView)) {
-        logger << logWarning << talker << " " << msgType << " message with bad longitude '"
-               << longitudeView << "' '" << eastOrWestView << "'" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message with bad longitude '"
+                        << longitudeView << "' '" << eastOrWestView << "'" << eol;
         return false;
     }
 
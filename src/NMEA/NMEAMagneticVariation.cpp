@@ -43,7 +43,7 @@ bool NMEAMagneticVariation::set(const etl::string_view &directionView,
         hasValue = false;
         return false;
     }
-    uint8_t directionAbsoluteValue = integerResult.value();
+    degrees = integerResult.value();
 
     if (periodPos != directionView.npos && directionView.length() > periodPos + 1) {
         etl::string_view decimalView(directionView.begin() + periodPos, directionView.end());
@@ -77,10 +77,10 @@ bool NMEAMagneticVariation::set(const etl::string_view &directionView,
     }
     switch (eastOrWestView.front()) {
         case 'W':
-            direction = directionAbsoluteValue;
+            east = false;
             break;
         case 'E':
-            direction = -directionAbsoluteValue;
+            east = true;
             break;
         default:
             hasValue = false;
@@ -94,23 +94,23 @@ bool NMEAMagneticVariation::set(const etl::string_view &directionView,
 bool NMEAMagneticVariation::extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType) {
     etl::string_view directionView;
     if (!nmeaLine.getWord(directionView)) {
-        logger << logWarning << talker << " " << msgType
-               << " message missing Magnetic Variation direction field" << eol;
+        LOG(logWarning) << talker << " " << msgType
+                        << " message missing Magnetic Variation direction field" << eol;
         hasValue = false;
         return false;
     }
     etl::string_view eastOrWestView;
     if (!nmeaLine.getWord(eastOrWestView)) {
-        logger << logWarning << talker << " " << msgType
-               << " message missing Magnetic Variation E/W field" << eol;
+        LOG(logWarning) << talker << " " << msgType
+                        << " message missing Magnetic Variation E/W field" << eol;
         hasValue = false;
         return false;
     }
 
     if (!set(directionView, eastOrWestView)) {
-        logger << logWarning << talker << " " << msgType
-               << " message with bad Magnetic Variation field '" << directionView << ","
-               << eastOrWestView << "'" << eol;
+        LOG(logWarning) << talker << " " << msgType
+                        << " message with bad Magnetic Variation field '" << directionView << ","
+                        << eastOrWestView << "'" << eol;
         return false;
     }
 
@@ -119,7 +119,8 @@ bool NMEAMagneticVariation::extract(NMEALine &nmeaLine, NMEATalker &talker, cons
 
 void NMEAMagneticVariation::publish(DataModelTenthsInt16Leaf &leaf) const {
     if (hasValue) {
-        leaf.set(direction, tenths);
+        const int32_t magnitude = degrees * 10 + tenths;
+        leaf.set(east ? -magnitude : magnitude);
     } else {
         leaf.removeValue();
     }
@@ -127,7 +128,7 @@ void NMEAMagneticVariation::publish(DataModelTenthsInt16Leaf &leaf) const {
 
 void NMEAMagneticVariation::log(Logger &logger) const {
     if (hasValue) {
-        logger << direction << "." << tenths << "\xC2\xB0";
+        logger << (east ? "-" : "") << degrees << "." << tenths << "\xC2\xB0";
     } else {
         logger << "Unknown";
     }
@@ -31,8 +31,10 @@
 
 class NMEAMagneticVariation : public LoggableItem {
     private:
-        int16_t direction;
+        // Westerly variation is published as positive and easterly as negative.
+        uint8_t degrees;
         uint8_t tenths;
+        bool east;
         bool hasValue;
 
         bool set(const etl::string_view &directionView, const etl::string_view &eastOrWestView);
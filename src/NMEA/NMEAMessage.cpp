@@ -20,13 +20,11 @@
 #include "NMEAMessage.h"
 #include "NMEATalker.h"
 #include "NMEAMsgType.h"
-#include "NMEADBKMessage.h"
-#include "NMEADBSMessage.h"
-#include "NMEADBTMessage.h"
+#include "NMEASentenceSchema.h"
+#include "NMEASchemaMessage.h"
 #include "NMEAGGAMessage.h"
 #include "NMEAGLLMessage.h"
 #include "NMEAGSAMessage.h"
-#include "NMEAGSTMessage.h"
 #include "NMEAGSVMessage.h"
 #include "NMEARMCMessage.h"
 #include "NMEATXTMessage.h"
@@ -35,7 +33,6 @@
 
 #include "Util/Logger.h"
 
-#include <etl/string.h>
 #include <etl/string_view.h>
 
 NMEAMessage::NMEAMessage(NMEATalker &talker) : talker(talker) {
@@ -49,14 +46,14 @@ bool NMEAMessage::extractConstantWord(NMEALine &nmeaLine, const char *messageTyp
                                       const char *constantWord) {
     etl::string_view word;
     if (!nmeaLine.getWord(word)) {
-        logger << logError << talker << " " << messageType << " message missing " << constantWord
-               << " field" << eol;
+        LOG(logError) << talker << " " << messageType << " message missing " << constantWord
+                      << " field" << eol;
         return false;
     }
 
     if (word != constantWord) {
-        logger << logError << talker << " " << messageType << " message with bad " << constantWord
-               << " field" << eol;
+        LOG(logError) << talker << " " << messageType << " message with bad " << constantWord
+                      << " field" << eol;
         return false;
     }
 
@@ -66,30 +63,18 @@ bool NMEAMessage::extractConstantWord(NMEALine &nmeaLine, const char *messageTyp
 NMEAMessage *parseNMEAMessage(NMEALine &nmeaLine) {
     etl::string_view tagView;
     if (!nmeaLine.getWord(tagView)) {
-        logger << logWarning << "NMEA message missing tag" << eol;
+        LOG(logWarning) << "NMEA message missing tag" << eol;
         return NULL;
     }
     if (tagView.size() != 5) {
-        logger << logWarning << "Bad NMEA tag '" << tagView << "'" << eol;
+        LOG(logWarning) << "Bad NMEA tag '" << tagView << "'" << eol;
         return NULL;
     }
 
-    etl::string<2> talkerCode(tagView.begin(), 2);
-    NMEATalker talker(talkerCode);
-
-    etl::string<3> msgTypeStr(tagView.begin() + 2, 3);
-    enum NMEAMsgType msgType = parseNMEAMsgType(msgTypeStr);
+    NMEATalker talker(tagView.begin());
+    enum NMEAMsgType msgType = parseNMEAMsgType(tagView.begin() + 2);
 
     switch (msgType) {
-        case NMEA_MSG_TYPE_DBK:
-            return parseNMEADBKMessage(talker, nmeaLine);
-
-        case NMEA_MSG_TYPE_DBS:
-            return parseNMEADBSMessage(talker, nmeaLine);
-
-        case NMEA_MSG_TYPE_DBT:
-            return parseNMEADBTMessage(talker, nmeaLine);
-
         case NMEA_MSG_TYPE_GGA:
             return parseNMEAGGAMessage(talker, nmeaLine);
 
@@ -99,9 +84,6 @@ NMEAMessage *parseNMEAMessage(NMEALine &nmeaLine) {
         case NMEA_MSG_TYPE_GSA:
             return parseNMEAGSAMessage(talker, nmeaLine);
 
-        case NMEA_MSG_TYPE_GST:
-            return parseNMEAGSTMessage(talker, nmeaLine);
-
         case NMEA_MSG_TYPE_GSV:
             return parseNMEAGSVMessage(talker, nmeaLine);
 
@@ -119,9 +101,20 @@ NMEAMessage *parseNMEAMessage(NMEALine &nmeaLine) {
             return parseNMEAVTGMessage(talker, nmeaLine);
 
         case NMEA_MSG_TYPE_UNKNOWN:
-        default:
-            logger << logWarning << "Unknown NMEA message type (" << msgTypeStr << ") from "
-                   << talker << eol;
+            LOG(logWarning) << "Unknown NMEA message type (" << tagView.substr(2) << ") from "
+                            << talker << eol;
             return NULL;
+
+        default:
+            {
+                // Sentences without a message class of their own are described by a schema.
+                const NMEASentenceSchema *schema = findNMEASentenceSchema(msgType);
+                if (schema == NULL) {
+                    LOG(logWarning) << "Unsupported NMEA message type (" << tagView.substr(2)
+                                    << ") from " << talker << eol;
+                    return NULL;
+                }
+                return parseNMEASchemaMessage(talker, *schema, nmeaLine);
+            }
     }
 }
@@ -21,9 +21,9 @@
 #include "NMEAGGAMessage.h"
 #include "NMEAGLLMessage.h"
 #include "NMEAGSAMessage.h"
-#include "NMEAGSTMessage.h"
 #include "NMEAGSVMessage.h"
 #include "NMEARMCMessage.h"
+#include "NMEASchemaMessage.h"
 #include "NMEATXTMessage.h"
 #include "NMEAVDMVDOMessage.h"
 #include "NMEAVTGMessage.h"
@@ -34,7 +34,7 @@
 
 #define NMEA_MESSAGE_BUFFER_SIZE \
 (MAX(MAX(MAX(MAX(sizeof(NMEAGGAMessage), sizeof(NMEAGSAMessage)), \
-             MAX(sizeof(NMEAGLLMessage), sizeof(NMEAGSTMessage))), \
+             MAX(sizeof(NMEAGLLMessage), sizeof(NMEASchemaMessage))), \
          MAX(MAX(sizeof(NMEAGSVMessage), sizeof(NMEARMCMessage)), \
              MAX(sizeof(NMEATXTMessage), sizeof(NMEAVDMVDOMessage)))), \
      sizeof(NMEAVTGMessage)))
@@ -20,37 +20,42 @@
 
 #include "Util/Error.h"
 
-#include <etl/string.h>
-
-enum NMEAMsgType parseNMEAMsgType(const etl::istring &msgTypeStr) {
-    if (msgTypeStr == "DBK") {
-        return NMEA_MSG_TYPE_DBK;
-    } else if (msgTypeStr == "DBS") {
-        return NMEA_MSG_TYPE_DBS;
-    } else if (msgTypeStr == "DBT") {
-        return NMEA_MSG_TYPE_DBT;
-    } else if (msgTypeStr == "GGA") {
-        return NMEA_MSG_TYPE_GGA;
-    } else if (msgTypeStr == "GLL") {
-        return NMEA_MSG_TYPE_GLL;
-    } else if (msgTypeStr == "GSA") {
-        return NMEA_MSG_TYPE_GSA;
-    } else if (msgTypeStr == "GST") {
-        return NMEA_MSG_TYPE_GST;
-    } else if (msgTypeStr == "GSV") {
-        return NMEA_MSG_TYPE_GSV;
-    } else if (msgTypeStr == "RMC") {
-        return NMEA_MSG_TYPE_RMC;
-    } else if (msgTypeStr == "TXT") {
-        return NMEA_MSG_TYPE_TXT;
-    } else if (msgTypeStr == "VDM") {
-        return NMEA_MSG_TYPE_VDM;
-    } else if (msgTypeStr == "VDO") {
-        return NMEA_MSG_TYPE_VDO;
-    } else if (msgTypeStr == "VTG") {
-        return NMEA_MSG_TYPE_VTG;
-    } else {
-        return NMEA_MSG_TYPE_UNKNOWN;
+enum NMEAMsgType parseNMEAMsgType(const char *msgTypeChars) {
+    switch (nmeaMsgTypeCode(msgTypeChars[0], msgTypeChars[1], msgTypeChars[2])) {
+        case nmeaMsgTypeCode('D', 'B', 'K'):
+            return NMEA_MSG_TYPE_DBK;
+        case nmeaMsgTypeCode('D', 'B', 'S'):
+            return NMEA_MSG_TYPE_DBS;
+        case nmeaMsgTypeCode('D', 'B', 'T'):
+            return NMEA_MSG_TYPE_DBT;
+        case nmeaMsgTypeCode('D', 'P', 'T'):
+            return NMEA_MSG_TYPE_DPT;
+        case nmeaMsgTypeCode('G', 'G', 'A'):
+            return NMEA_MSG_TYPE_GGA;
+        case nmeaMsgTypeCode('G', 'L', 'L'):
+            return NMEA_MSG_TYPE_GLL;
+        case nmeaMsgTypeCode('G', 'S', 'A'):
+            return NMEA_MSG_TYPE_GSA;
+        case nmeaMsgTypeCode('G', 'S', 'T'):
+            return NMEA_MSG_TYPE_GST;
+        case nmeaMsgTypeCode('G', 'S', 'V'):
+            return NMEA_MSG_TYPE_GSV;
+        case nmeaMsgTypeCode('M', 'T', 'W'):
+            return NMEA_MSG_TYPE_MTW;
+        case nmeaMsgTypeCode('R', 'M', 'C'):
+            return NMEA_MSG_TYPE_RMC;
+        case nmeaMsgTypeCode('T', 'X', 'T'):
+            return NMEA_MSG_TYPE_TXT;
+        case nmeaMsgTypeCode('V', 'D', 'M'):
+            return NMEA_MSG_TYPE_VDM;
+        case nmeaMsgTypeCode('V', 'D', 'O'):
+            return NMEA_MSG_TYPE_VDO;
+        case nmeaMsgTypeCode('V', 'H', 'W'):
+            return NMEA_MSG_TYPE_VHW;
+        case nmeaMsgTypeCode('V', 'T', 'G'):
+            return NMEA_MSG_TYPE_VTG;
+        default:
+            return NMEA_MSG_TYPE_UNKNOWN;
     }
 }
 
@@ -64,6 +69,8 @@ const char *nmeaMsgTypeName(NMEAMsgType msgType) {
             return "DBS";
         case NMEA_MSG_TYPE_DBT:
             return "DBT";
+        case NMEA_MSG_TYPE_DPT:
+            return "DPT";
         case NMEA_MSG_TYPE_GGA:
             return "GGA";
         case NMEA_MSG_TYPE_GLL:
@@ -74,6 +81,8 @@ const char *nmeaMsgTypeName(NMEAMsgType msgType) {
             return "GST";
         case NMEA_MSG_TYPE_GSV:
             return "GSV";
+        case NMEA_MSG_TYPE_MTW:
+            return "MTW";
         case NMEA_MSG_TYPE_RMC:
             return "RMC";
         case NMEA_MSG_TYPE_TXT:
@@ -82,6 +91,8 @@ const char *nmeaMsgTypeName(NMEAMsgType msgType) {
             return "VDM";
         case NMEA_MSG_TYPE_VDO:
             return "VDO";
+        case NMEA_MSG_TYPE_VHW:
+            return "VHW";
         case NMEA_MSG_TYPE_VTG:
             return "VTG";
         default:
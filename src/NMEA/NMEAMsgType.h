@@ -19,26 +19,36 @@
 #ifndef NMEA_MSG_TYPE_H
 #define NMEA_MSG_TYPE_H
 
-#include <etl/string.h>
+#include <stdint.h>
 
 enum NMEAMsgType {
     NMEA_MSG_TYPE_UNKNOWN,
     NMEA_MSG_TYPE_DBK,
     NMEA_MSG_TYPE_DBS,
     NMEA_MSG_TYPE_DBT,
+    NMEA_MSG_TYPE_DPT,
     NMEA_MSG_TYPE_GGA,
     NMEA_MSG_TYPE_GLL,
     NMEA_MSG_TYPE_GSA,
     NMEA_MSG_TYPE_GST,
     NMEA_MSG_TYPE_GSV,
+    NMEA_MSG_TYPE_MTW,
     NMEA_MSG_TYPE_RMC,
     NMEA_MSG_TYPE_TXT,
     NMEA_MSG_TYPE_VDM,
     NMEA_MSG_TYPE_VDO,
-    NMEA_MSG_TYPE_VTG
+    NMEA_MSG_TYPE_VHW,
+    NMEA_MSG_TYPE_VTG,
+    NMEA_MSG_TYPE_COUNT
 };
 
-enum NMEAMsgType parseNMEAMsgType(const etl::istring &msgTypeStr);
+// The three character formatter of an NMEA tag packed into an integer, first character in the most
+// significant byte, so that it can be dispatched on with a switch rather than string compares.
+constexpr uint32_t nmeaMsgTypeCode(char first, char second, char third) {
+    return ((uint32_t)(uint8_t)first << 16) | ((uint32_t)(uint8_t)second << 8) | (uint8_t)third;
+}
+
+enum NMEAMsgType parseNMEAMsgType(const char *msgTypeChars);
 const char *nmeaMsgTypeName(NMEAMsgType msgType);
 
 #endif
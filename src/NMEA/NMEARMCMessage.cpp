@@ -21,7 +21,7 @@
 #include "NMEADataValid.h"
 #include "NMEALatitude.h"
 #include "NMEALongitude.h"
-#include "NMEATenthsUInt16.h"
+#include "NMEAFixedPoint.h"
 #include "NMEADate.h"
 #include "NMEAMagneticVariation.h"
 #include "NMEAFAAModeIndicator.h"
@@ -37,7 +37,7 @@ NMEARMCMessage::NMEARMCMessage(NMEATalker &talker) : NMEAMessage(talker) {
 
 bool NMEARMCMessage::parse(NMEALine &nmeaLine) {
     if (nmeaLine.isEncapsulatedData()) {
-        logger << logWarning << talker << " RMC message in unsupported encapsulated format" << eol;
+        LOG(logWarning) << talker << " RMC message in unsupported encapsulated format" << eol;
         return false;
     }
 
@@ -24,7 +24,7 @@
 #include "NMEADataValid.h"
 #include "NMEALatitude.h"
 #include "NMEALongitude.h"
-#include "NMEATenthsUInt16.h"
+#include "NMEAFixedPoint.h"
 #include "NMEADate.h"
 #include "NMEAMagneticVariation.h"
 #include "NMEAFAAModeIndicator.h"
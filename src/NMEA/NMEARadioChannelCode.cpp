@@ -47,20 +47,32 @@ bool NMEARadioChannelCode::set(const etl::string_view &radioChannelCodeView) {
 bool NMEARadioChannelCode::extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType) {
     etl::string_view radioChannelCodeView;
     if (!nmeaLine.getWord(radioChannelCodeView)) {
-        logger << logWarning << talker << " " << msgType
-               << " message missing Radio Channel Code field" << eol;
+        LOG(logWarning) << talker << " " << msgType
+                        << " message missing Radio Channel Code field" << eol;
         return false;
     }
     if (!set(radioChannelCodeView)) {
-        logger << logWarning << talker << " " << msgType
-               << " message with bad Radio Channel Code field '" << radioChannelCodeView << "'"
-               << eol;
+        LOG(logWarning) << talker << " " << msgType
+                        << " message with bad Radio Channel Code field '" << radioChannelCodeView
+                        << "'" << eol;
         return false;
     }
 
     return true;
 }
 
+// Returns the AIS channel letter, 'A' or 'B'.
+char NMEARadioChannelCode::channel() const {
+    switch (radioChannelCode) {
+        case RADIO_CHANNEL_87B:
+            return 'A';
+
+        case RADIO_CHANNEL_88B:
+        default:
+            return 'B';
+    }
+}
+
 void NMEARadioChannelCode::publish(DataModelStringLeaf &leaf) const {
     switch (radioChannelCode) {
         case RADIO_CHANNEL_87B:
@@ -41,6 +41,7 @@ class NMEARadioChannelCode : public LoggableItem {
 
     public:
         bool extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType);
+        char channel() const;
         void publish(DataModelStringLeaf &leaf) const;
         virtual void log(Logger &logger) const override;
 };
@@ -0,0 +1,224 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NMEASchemaMessage.h"
+#include "NMEASentenceSchema.h"
+#include "NMEAMessage.h"
+#include "NMEAMsgType.h"
+#include "NMEATime.h"
+#include "NMEATalker.h"
+#include "NMEALine.h"
+#include "NMEAMessageBuffer.h"
+#include "NMEAFixedPoint.h"
+
+#include "DataModel/DataModelTenthsUInt16Leaf.h"
+#include "DataModel/DataModelTenthsInt16Leaf.h"
+#include "DataModel/DataModelHundredthsUInt16Leaf.h"
+#include "DataModel/DataModelRetainedValueLeaf.h"
+
+#include "Util/PlacementNew.h"
+#include "Util/Logger.h"
+#include "Util/Error.h"
+
+#include <etl/string_view.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Keeps the whole part of converted numbers within the 16 bit leaves.
+static const uint32_t maxWholeNumber = 65535;
+
+NMEASchemaMessage::NMEASchemaMessage(NMEATalker &talker, const NMEASentenceSchema &schema)
+    : NMEAMessage(talker), schema(schema) {
+}
+
+bool NMEASchemaMessage::parse(NMEALine &nmeaLine) {
+    const char *msgTypeName = nmeaMsgTypeName(schema.msgType);
+
+    if (nmeaLine.isEncapsulatedData()) {
+        LOG(logWarning) << talker << " " << msgTypeName
+                        << " message in unsupported encapsulated format" << eol;
+        return false;
+    }
+
+    for (size_t fieldIndex = 0; fieldIndex < schema.fieldCount; fieldIndex++) {
+        const NMEAFieldSchema &field = schema.fields[fieldIndex];
+        etl::string_view &fieldView = fieldViews[fieldIndex];
+
+        if (!nmeaLine.getWord(fieldView)) {
+            fieldView = etl::string_view();
+        }
+        if (fieldView.empty()) {
+            if (field.optional) {
+                continue;
+            }
+            LOG(logWarning) << talker << " " << msgTypeName << " message missing "
+                            << field.name << " field" << eol;
+            return false;
+        }
+
+        switch (field.kind) {
+            case NMEA_FIELD_CONSTANT:
+                if (fieldView != field.name) {
+                    LOG(logError) << talker << " " << msgTypeName << " message with bad "
+                                  << field.name << " field" << eol;
+                    return false;
+                }
+                break;
+
+            case NMEA_FIELD_TIME:
+                if (!time.setField(fieldView, talker, msgTypeName)) {
+                    return false;
+                }
+                break;
+
+            case NMEA_FIELD_UNSIGNED:
+            case NMEA_FIELD_SIGNED:
+                break;
+        }
+    }
+
+    return true;
+}
+
+bool NMEASchemaMessage::fieldValue(size_t fieldIndex, int32_t &value) const {
+    const NMEAFieldSchema &field = schema.fields[fieldIndex];
+    const etl::string_view &fieldView = fieldViews[fieldIndex];
+
+    if (fieldView.empty()) {
+        return false;
+    }
+
+    uint32_t wholeNumber;
+    uint32_t fraction;
+    bool negative;
+    if (!nmeaParseFixedPoint(fieldView, field.kind == NMEA_FIELD_SIGNED, field.scale,
+                             maxWholeNumber, wholeNumber, fraction, negative)) {
+        LOG(logWarning) << "NMEA message with bad " << field.name << " field '"
+                        << fieldView << "'" << eol;
+        return false;
+    }
+
+    const int32_t scaled = wholeNumber * nmeaPowerOfTen(field.scale) + fraction;
+    value = negative ? -scaled : scaled;
+
+    return true;
+}
+
+void NMEASchemaMessage::publishField(size_t fieldIndex) const {
+    const NMEAFieldSchema &field = schema.fields[fieldIndex];
+
+    int32_t value;
+    if (!fieldValue(fieldIndex, value)) {
+        ((DataModelRetainedValueLeaf *)field.leaf)->removeValue();
+        return;
+    }
+
+    if (field.kind == NMEA_FIELD_UNSIGNED && field.scale == 1) {
+        ((DataModelTenthsUInt16Leaf *)field.leaf)->set(value / 10, value % 10);
+    } else if (field.kind == NMEA_FIELD_SIGNED && field.scale == 1) {
+        ((DataModelTenthsInt16Leaf *)field.leaf)->set(value);
+    } else if (field.kind == NMEA_FIELD_UNSIGNED && field.scale == 2) {
+        ((DataModelHundredthsUInt16Leaf *)field.leaf)->set(value / 100, value % 100);
+    } else {
+        fatalError("Unsupported NMEA schema field kind for publishing");
+    }
+}
+
+void NMEASchemaMessage::publish() const {
+    for (size_t fieldIndex = 0; fieldIndex < schema.fieldCount; fieldIndex++) {
+        if (schema.fields[fieldIndex].leaf != NULL) {
+            publishField(fieldIndex);
+        }
+    }
+}
+
+enum NMEAMsgType NMEASchemaMessage::type() const {
+    return schema.msgType;
+}
+
+void NMEASchemaMessage::logField(size_t fieldIndex) const {
+    const NMEAFieldSchema &field = schema.fields[fieldIndex];
+
+    switch (field.kind) {
+        case NMEA_FIELD_CONSTANT:
+            break;
+
+        case NMEA_FIELD_TIME:
+            logger << " " << time;
+            break;
+
+        case NMEA_FIELD_UNSIGNED:
+        case NMEA_FIELD_SIGNED:
+            logger << " " << field.name << " ";
+            logValue(fieldIndex);
+            break;
+    }
+}
+
+void NMEASchemaMessage::logValue(size_t fieldIndex) const {
+    const NMEAFieldSchema &field = schema.fields[fieldIndex];
+
+    int32_t value;
+    if (!fieldValue(fieldIndex, value)) {
+        logger << "NA";
+        return;
+    }
+
+    uint32_t divisor = 1;
+    for (uint8_t decimalPlace = 0; decimalPlace < field.scale; decimalPlace++) {
+        divisor *= 10;
+    }
+    const uint32_t magnitude = value < 0 ? -value : value;
+    if (value < 0) {
+        logger << "-";
+    }
+    logger << magnitude / divisor;
+    if (field.scale) {
+        const uint32_t fraction = magnitude % divisor;
+        logger << ".";
+        for (uint32_t placeValue = divisor / 10; placeValue > 1 && fraction < placeValue;
+             placeValue /= 10) {
+            logger << "0";
+        }
+        logger << fraction;
+    }
+}
+
+void NMEASchemaMessage::log() const {
+    logger << logDebugNMEA << talker << " " << nmeaMsgTypeName(schema.msgType) << ":";
+    for (size_t fieldIndex = 0; fieldIndex < schema.fieldCount; fieldIndex++) {
+        logField(fieldIndex);
+    }
+    logger << eol;
+}
+
+NMEASchemaMessage *parseNMEASchemaMessage(NMEATalker &talker, const NMEASentenceSchema &schema,
+                                          NMEALine &nmeaLine) {
+    NMEASchemaMessage *message = new (nmeaMessageBuffer)NMEASchemaMessage(talker, schema);
+    if (!message) {
+        return NULL;
+    }
+
+    if (!message->parse(nmeaLine)) {
+        // Since we use a static buffer and placement new for messages, we don't do a free here.
+        return NULL;
+    }
+
+    return message;
+}
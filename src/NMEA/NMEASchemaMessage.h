@@ -0,0 +1,59 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NMEA_SCHEMA_MESSAGE_H
+#define NMEA_SCHEMA_MESSAGE_H
+
+#include "NMEAMessage.h"
+#include "NMEASentenceSchema.h"
+#include "NMEATime.h"
+#include "NMEATalker.h"
+#include "NMEALine.h"
+
+#include <etl/string_view.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// A message for any sentence described by an NMEASentenceSchema. Like the lazy fields of the hand
+// written messages, parsing only checks that the fields are present and records where they are in
+// the line, with the numbers converted when they're published or logged.
+class NMEASchemaMessage : public NMEAMessage {
+    private:
+        const NMEASentenceSchema &schema;
+        NMEATime time;
+        etl::string_view fieldViews[nmeaMaxSchemaFields];
+
+        bool fieldValue(size_t fieldIndex, int32_t &value) const;
+        void publishField(size_t fieldIndex) const;
+        void logField(size_t fieldIndex) const;
+        void logValue(size_t fieldIndex) const;
+
+    public:
+        NMEASchemaMessage(NMEATalker &talker, const NMEASentenceSchema &schema);
+        bool parse(NMEALine &nmeaLine);
+        void publish() const;
+        virtual enum NMEAMsgType type() const override;
+        virtual void log() const override;
+};
+
+extern NMEASchemaMessage *parseNMEASchemaMessage(NMEATalker &talker,
+                                                 const NMEASentenceSchema &schema,
+                                                 NMEALine &nmeaLine);
+
+#endif
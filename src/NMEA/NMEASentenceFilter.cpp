@@ -0,0 +1,110 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NMEASentenceFilter.h"
+#include "NMEAMsgType.h"
+#include "NMEATalker.h"
+
+#include "DataModel/DataModel.h"
+#include "DataModel/DataModelStringLeaf.h"
+
+#include "StatsManager/StatsManager.h"
+
+#include "Util/Error.h"
+
+#include <etl/string.h>
+#include <etl/string_stream.h>
+
+#include <stdint.h>
+
+NMEASentenceFilter::NMEASentenceFilter(DataModelStringLeaf &droppedDataModelLeaf,
+                                       StatsManager &statsManager)
+    : rules(), droppedDataModelLeaf(droppedDataModelLeaf) {
+    statsManager.addStatsHolder(this);
+}
+
+void NMEASentenceFilter::addRule(uint16_t talkerCode, uint32_t formatterCode) {
+    for (const Rule &rule : rules) {
+        if (rule.talkerCode == talkerCode && rule.formatterCode == formatterCode) {
+            return;
+        }
+    }
+
+    if (rules.full()) {
+        fatalError("Too many rules in NMEA sentence filter");
+    }
+
+    rules.push_back({ formatterCode, talkerCode, 0 });
+}
+
+// Rejects the formatter, packed with nmeaMsgTypeCode, from every talker.
+void NMEASentenceFilter::reject(uint32_t formatterCode) {
+    addRule(anyTalker, formatterCode);
+}
+
+void NMEASentenceFilter::reject(uint16_t talkerCode, uint32_t formatterCode) {
+    addRule(talkerCode, formatterCode);
+}
+
+// Takes the five characters of a tag, the talker followed by the formatter, and returns true if
+// the sentence should be processed.
+bool NMEASentenceFilter::accepts(const char *tagChars) {
+    const uint32_t formatterCode = nmeaMsgTypeCode(tagChars[2], tagChars[3], tagChars[4]);
+    const uint16_t talkerCode = nmeaTalkerCode(tagChars[0], tagChars[1]);
+
+    for (Rule &rule : rules) {
+        if (rule.formatterCode == formatterCode &&
+            (rule.talkerCode == anyTalker || rule.talkerCode == talkerCode)) {
+            rule.dropped++;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Each count is named by the rule's formatter, preceded by the talker for a single talker rule.
+void NMEASentenceFilter::exportStats(__attribute__((unused)) uint32_t msElapsed) {
+    etl::string<maxNMEAFilteredLength> droppedStr;
+    etl::string_stream droppedStrStream(droppedStr);
+    bool firstInList = true;
+    for (const Rule &rule : rules) {
+        if (rule.dropped) {
+            if (!firstInList) {
+                droppedStrStream << ",";
+            } else {
+                firstInList = false;
+            }
+
+            char ruleName[6];
+            char *ruleNameChar = ruleName;
+            if (rule.talkerCode != anyTalker) {
+                *ruleNameChar++ = rule.talkerCode >> 8;
+                *ruleNameChar++ = rule.talkerCode & 0xff;
+            }
+            *ruleNameChar++ = (rule.formatterCode >> 16) & 0xff;
+            *ruleNameChar++ = (rule.formatterCode >> 8) & 0xff;
+            *ruleNameChar++ = rule.formatterCode & 0xff;
+            *ruleNameChar = 0;
+
+            droppedStrStream << ruleName << ":" << rule.dropped;
+        }
+    }
+
+    droppedDataModelLeaf = droppedStr;
+}
@@ -0,0 +1,60 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NMEA_SENTENCE_FILTER_H
+#define NMEA_SENTENCE_FILTER_H
+
+class DataModelStringLeaf;
+class StatsManager;
+
+#include "StatsManager/StatsHolder.h"
+
+#include <etl/vector.h>
+
+#include <stdint.h>
+
+// Decides, from just the tag at the start of a line, whether an NMEASource should process a
+// sentence at all. Sentences that nothing consumes are dropped before their checksum is checked or
+// any parsing is done. Rules are keyed on the packed formatter, as given by nmeaMsgTypeCode, so
+// formatters that the parser doesn't know can be rejected one by one, and apply to every talker or
+// to just one. Counts of the dropped sentences, by rule, are exported as a string leaf.
+class NMEASentenceFilter : public StatsHolder {
+    private:
+        struct Rule {
+            uint32_t formatterCode;
+            uint16_t talkerCode;
+            uint32_t dropped;
+        };
+
+        static const uint16_t anyTalker = 0;
+        static const size_t maxRules = 8;
+
+        etl::vector<Rule, maxRules> rules;
+        DataModelStringLeaf &droppedDataModelLeaf;
+
+        void addRule(uint16_t talkerCode, uint32_t formatterCode);
+
+    public:
+        NMEASentenceFilter(DataModelStringLeaf &droppedDataModelLeaf, StatsManager &statsManager);
+        void reject(uint32_t formatterCode);
+        void reject(uint16_t talkerCode, uint32_t formatterCode);
+        bool accepts(const char *tagChars);
+        virtual void exportStats(uint32_t msElapsed) override;
+};
+
+#endif
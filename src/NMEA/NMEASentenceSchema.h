@@ -0,0 +1,103 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NMEA_SENTENCE_SCHEMA_H
+#define NMEA_SENTENCE_SCHEMA_H
+
+#include "NMEAMsgType.h"
+
+#include "DataModel/DataModelLeaf.h"
+#include "DataModel/DataModelTenthsUInt16Leaf.h"
+#include "DataModel/DataModelTenthsInt16Leaf.h"
+#include "DataModel/DataModelHundredthsUInt16Leaf.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Sentences made up only of numbers, fixed unit words and possibly a time are described by a table
+// of fields rather than each having a message class of their own. A single message class,
+// NMEASchemaMessage, walks the table to parse, log and publish any of them.
+
+enum NMEAFieldKind : uint8_t {
+    NMEA_FIELD_UNSIGNED,
+    NMEA_FIELD_SIGNED,
+    NMEA_FIELD_CONSTANT,
+    NMEA_FIELD_TIME
+};
+
+struct NMEAFieldSchema {
+    NMEAFieldKind kind;
+    // Number of decimal places kept for numeric fields.
+    uint8_t scale;
+    bool optional;
+    // Name of the field used in logging, or for constant fields the word that must be present.
+    const char *name;
+    // Where the value is published, NULL if it isn't.
+    DataModelLeaf *leaf;
+};
+
+const size_t nmeaMaxSchemaFields = 8;
+
+struct NMEASentenceSchema {
+    NMEAMsgType msgType;
+    const NMEAFieldSchema *fields;
+    uint8_t fieldCount;
+};
+
+// The field constructors pick the kind and scale from the type of leaf being published to so that
+// the two can't disagree.
+constexpr NMEAFieldSchema nmeaField(const char *name, DataModelTenthsUInt16Leaf *leaf,
+                                    bool optional = false) {
+    return NMEAFieldSchema{NMEA_FIELD_UNSIGNED, 1, optional, name, leaf};
+}
+
+constexpr NMEAFieldSchema nmeaField(const char *name, DataModelTenthsInt16Leaf *leaf,
+                                    bool optional = false) {
+    return NMEAFieldSchema{NMEA_FIELD_SIGNED, 1, optional, name, leaf};
+}
+
+constexpr NMEAFieldSchema nmeaField(const char *name, DataModelHundredthsUInt16Leaf *leaf,
+                                    bool optional = false) {
+    return NMEAFieldSchema{NMEA_FIELD_UNSIGNED, 2, optional, name, leaf};
+}
+
+// A numeric field that's checked and logged, but not published.
+constexpr NMEAFieldSchema nmeaUnpublishedField(const char *name, bool isSigned, uint8_t scale,
+                                               bool optional = false) {
+    return NMEAFieldSchema{isSigned ? NMEA_FIELD_SIGNED : NMEA_FIELD_UNSIGNED, scale, optional,
+                           name, NULL};
+}
+
+constexpr NMEAFieldSchema nmeaConstantField(const char *word, bool optional = false) {
+    return NMEAFieldSchema{NMEA_FIELD_CONSTANT, 0, optional, word, NULL};
+}
+
+constexpr NMEAFieldSchema nmeaTimeField() {
+    return NMEAFieldSchema{NMEA_FIELD_TIME, 0, false, "Time", NULL};
+}
+
+template <size_t fieldCount>
+constexpr NMEASentenceSchema nmeaSentenceSchema(NMEAMsgType msgType,
+                                                const NMEAFieldSchema (&fields)[fieldCount]) {
+    static_assert(fieldCount <= nmeaMaxSchemaFields, "Too many fields in NMEA sentence schema");
+    return NMEASentenceSchema{msgType, fields, fieldCount};
+}
+
+const NMEASentenceSchema *findNMEASentenceSchema(NMEAMsgType msgType);
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NMEASentenceSchema.h"
+#include "NMEAMsgType.h"
+
+#include "DataModel/DataModel.h"
+
+#include <stddef.h>
+
+// DBK, DBS and DBT: Depth below keel, surface and transducer, in feet, meters and fathoms.
+static constexpr NMEAFieldSchema dbkFields[] = {
+    nmeaField("Depth Feet", &depthBelowKeelFeet, true),
+    nmeaConstantField("f"),
+    nmeaField("Depth Meters", &depthBelowKeelMeters, true),
+    nmeaConstantField("M"),
+    nmeaField("Depth Fathoms", &depthBelowKeelFathoms, true),
+    nmeaConstantField("F")
+};
+
+static constexpr NMEAFieldSchema dbsFields[] = {
+    nmeaField("Depth Feet", &depthBelowSurfaceFeet, true),
+    nmeaConstantField("f"),
+    nmeaField("Depth Meters", &depthBelowSurfaceMeters, true),
+    nmeaConstantField("M"),
+    nmeaField("Depth Fathoms", &depthBelowSurfaceFathoms, true),
+    nmeaConstantField("F")
+};
+
+static constexpr NMEAFieldSchema dbtFields[] = {
+    nmeaField("Depth Feet", &depthBelowTransducerFeet, true),
+    nmeaConstantField("f"),
+    nmeaField("Depth Meters", &depthBelowTransducerMeters, true),
+    nmeaConstantField("M"),
+    nmeaField("Depth Fathoms", &depthBelowTransducerFathoms, true),
+    nmeaConstantField("F")
+};
+
+// DPT: Depth below the transducer in meters, the offset from the transducer to the waterline
+// (positive) or keel (negative), and, in NMEA 3.0 and later, the maximum range.
+static constexpr NMEAFieldSchema dptFields[] = {
+    nmeaField("Depth Meters", &depthDPTBelowTransducer),
+    nmeaUnpublishedField("Offset", true, 1, true),
+    nmeaUnpublishedField("Maximum Range", false, 1, true)
+};
+
+// GST: GPS pseudorange noise statistics.
+static constexpr NMEAFieldSchema gstFields[] = {
+    nmeaTimeField(),
+    nmeaField("RMS Value of Standard Deviation of Range Inputs",
+              &gpsStandardDeviationOfRangeInputsRMS),
+    nmeaField("Standard Deviation of Semi-Major Axis of Error Ellipse",
+              &gpsStandardDeviationOfSemiMajorAxis, true),
+    nmeaField("Standard Deviation of Semi-Minor Axis of Error Ellipse",
+              &gpsStandardDeviationOfSemiMinorAxis, true),
+    nmeaField("Orientation of Semi-Major Axis of Error Ellipse", &gpsOrientationOfSemiMajorAxis,
+              true),
+    nmeaField("Standard Deviation of Latitude Error", &gpsStandardDeviationOfLatitudeError),
+    nmeaField("Standard Deviation of Longitude Error", &gpsStandardDeviationOfLongitudeError),
+    nmeaField("Standard Deviation of Altitude Error", &gpsStandardDeviationOfAltitudeError)
+};
+
+// MTW: Water temperature in degrees Celsius.
+static constexpr NMEAFieldSchema mtwFields[] = {
+    nmeaField("Water Temperature", &waterTemperature),
+    nmeaConstantField("C")
+};
+
+// VHW: Heading, true and magnetic, and speed through the water in knots and km/h.
+static constexpr NMEAFieldSchema vhwFields[] = {
+    nmeaField("Heading True", &headingTrue, true),
+    nmeaConstantField("T", true),
+    nmeaField("Heading Magnetic", &headingMagnetic, true),
+    nmeaConstantField("M", true),
+    nmeaField("Speed Through Water Knots", &waterSpeed, true),
+    nmeaConstantField("N", true),
+    nmeaField("Speed Through Water km/h", &waterSpeedKmPerH, true),
+    nmeaConstantField("K", true)
+};
+
+static constexpr NMEASentenceSchema sentenceSchemas[] = {
+    nmeaSentenceSchema(NMEA_MSG_TYPE_DBK, dbkFields),
+    nmeaSentenceSchema(NMEA_MSG_TYPE_DBS, dbsFields),
+    nmeaSentenceSchema(NMEA_MSG_TYPE_DBT, dbtFields),
+    nmeaSentenceSchema(NMEA_MSG_TYPE_DPT, dptFields),
+    nmeaSentenceSchema(NMEA_MSG_TYPE_GST, gstFields),
+    nmeaSentenceSchema(NMEA_MSG_TYPE_MTW, mtwFields),
+    nmeaSentenceSchema(NMEA_MSG_TYPE_VHW, vhwFields)
+};
+
+const NMEASentenceSchema *findNMEASentenceSchema(NMEAMsgType msgType) {
+    for (const NMEASentenceSchema &schema : sentenceSchemas) {
+        if (schema.msgType == msgType) {
+            return &schema;
+        }
+    }
+
+    return NULL;
+}
@@ -20,6 +20,8 @@
 #include "NMEALine.h"
 #include "NMEAMessage.h"
 #include "NMEAMessageHandler.h"
+#include "NMEASentenceFilter.h"
+#include "NMEADuplicateSuppressor.h"
 
 #include "DataModel/DataModel.h"
 #include "DataModel/DataModelLeaf.h"
@@ -31,19 +33,39 @@
 #include "Util/Logger.h"
 #include "Util/Error.h"
 
+#include <Arduino.h>
 #include <Stream.h>
 
+#include <stdint.h>
 #include <stddef.h>
+#include <string.h>
 
 NMEASource::NMEASource(Stream &stream, DataModelLeaf &messageCountDataModelLeaf,
-                       DataModelLeaf &messageRateDataModelLeaf, StatsManager &statsManager)
+                       DataModelLeaf &messageRateDataModelLeaf,
+                       DataModelLeaf &backlogDataModelLeaf,
+                       DataModelLeaf &budgetExhaustionsDataModelLeaf,
+                       DataModelLeaf &overlengthLinesDataModelLeaf, StatsManager &statsManager)
     : stream(stream),
-      bufferPos(0),
-      remaining(0),
-      carriageReturnFound(false),
+      lineStartIndex(0),
+      scanIndex(0),
+      writeIndex(0),
+      lineXOR(0),
+      discardingLine(false),
+      maxLinesPerService(defaultMaxLinesPerService),
+      maxMicrosecondsPerService(defaultMaxMicrosecondsPerService),
+      unreadStreamBytes(0),
       messageHandlers(),
+      sentenceFilter(NULL),
+      duplicateSuppressor(NULL),
+      duplicateSourceIndex(0),
       messageCountDataModelLeaf(messageCountDataModelLeaf),
-      messageRateDataModelLeaf(messageRateDataModelLeaf) {
+      messageRateDataModelLeaf(messageRateDataModelLeaf),
+      peakBacklog(0),
+      budgetExhaustions(0),
+      backlogDataModelLeaf(backlogDataModelLeaf),
+      budgetExhaustionsDataModelLeaf(budgetExhaustionsDataModelLeaf),
+      overlengthLines(0),
+      overlengthLinesDataModelLeaf(overlengthLinesDataModelLeaf) {
     statsManager.addStatsHolder(this);
 }
 
@@ -55,16 +77,41 @@ void NMEASource::addMessageHandler(NMEAMessageHandler &messageHandler) {
     messageHandlers.push_back(&messageHandler);
 }
 
+void NMEASource::setSentenceFilter(NMEASentenceFilter &sentenceFilter) {
+    this->sentenceFilter = &sentenceFilter;
+}
+
+// Sources sharing a duplicate suppressor drop lines that another of them has just delivered. If
+// this source is the preferred one, its lines are never dropped in favor of another source's.
+void NMEASource::setDuplicateSuppressor(NMEADuplicateSuppressor &duplicateSuppressor,
+                                        DataModelLeaf &duplicatesDataModelLeaf, bool preferred) {
+    this->duplicateSuppressor = &duplicateSuppressor;
+    duplicateSourceIndex = duplicateSuppressor.addSource(duplicatesDataModelLeaf);
+    if (preferred) {
+        duplicateSuppressor.setPolicy(NMEADuplicateSuppressor::PREFERRED_SOURCE_WINS,
+                                      duplicateSourceIndex);
+    }
+}
+
+void NMEASource::setServiceBudget(unsigned maxLines, uint32_t maxMicroseconds) {
+    maxLinesPerService = maxLines;
+    maxMicrosecondsPerService = maxMicroseconds;
+}
 
-bool NMEASource::scanForCarriageReturn(size_t &carriageReturnPos) {
-    size_t scanRemaining;
-    size_t scanPos;
 
-    for (scanPos = bufferPos, scanRemaining = remaining;
-        scanRemaining;
-        scanPos++, scanRemaining--) {
-        if (buffer[scanPos] == '\r') {
-            carriageReturnPos = scanPos;
+// Scans the unscanned part of the ring for a carriage return, picking up where the last scan left
+// off and accumulating the line's XOR as it goes. The data may wrap, in which case it's scanned in
+// two pieces.
+bool NMEASource::scanForCarriageReturn(size_t &carriageReturnIndex) {
+    while (scanIndex != writeIndex) {
+        const size_t scanPos = scanIndex & ringMask;
+        const size_t contiguous = min(writeIndex - scanIndex, ringSize - scanPos);
+        const char *scanStart = ring + scanPos;
+        const char *scanEnd = scanStart + contiguous;
+        const char *carriageReturn = findCharacterWithXOR(scanStart, scanEnd, '\r', lineXOR);
+        scanIndex += carriageReturn - scanStart;
+        if (carriageReturn != scanEnd) {
+            carriageReturnIndex = scanIndex;
             return true;
         }
     }
@@ -72,83 +119,143 @@ bool NMEASource::scanForCarriageReturn(size_t &carriageReturnPos) {
     return false;
 }
 
-bool NMEASource::processBuffer() {
-    // Since NMEA 0183 has CR/LF terminated lines, if the last thing we looked at was a carriage
-    // return, we should be looking at a line feed.
-    if (carriageReturnFound) {
-        if (isLineFeed(buffer[bufferPos])) {
-            // Skip past the line feed and return saying the line is ready for processing.
-            bufferPos++;
-            remaining--;
-            carriageReturnFound = false;
-            return true;
-        } else {
-            // We had a carriage return without the associated line feed. Toss out any characters
-            // that we had accumulated in the line and move on, processing the buffer.
-            logger << logWarning << "NMEA line with CR, but no LF. Ignoring." << eol;
-            inputLine.reset();
-            carriageReturnFound = false;
-        }
+// Checks the tag of a line, still in place in the ring, against the sentence filter. Lines too short
+// to have a tag are let through for the sanity check to deal with.
+bool NMEASource::filterAccepts(size_t lineStart, size_t lineLength) {
+    const size_t tagLength = 5;
+    if (sentenceFilter == NULL || lineLength < 1 + tagLength) {
+        return true;
     }
 
-    size_t carriageReturnPos;
-    if (scanForCarriageReturn(carriageReturnPos)) {
-        // We have a CR, move the characters up to that point into the line.
-        inputLine.append(buffer, bufferPos, carriageReturnPos);
-        remaining -= carriageReturnPos - bufferPos + 1;
-        bufferPos = carriageReturnPos + 1;
-
-        // If we have at least one more character in the buffer make sure it's an LF
-        if (remaining) {
-            if (isLineFeed(buffer[bufferPos])) {
-                // The line was correctly terminated and should be ready to go.
-                remaining--;
-                bufferPos++;
-                return true;
-            } else {
-                // We had a carriage return without the associated line feed. Toss out any
-                // characters that we had accumulated in the line. If we still have characters in
-                // the buffer, recursively process those.
-                logger << logWarning << "NMEA line with CR, but no LF. Ignoring." << eol;
-                inputLine.reset();
-                remaining--;
-                bufferPos++;
-                if (remaining) {
-                    return processBuffer();
-                } else {
-                    bufferPos = 0;
-                    return false;
-                }
-            }
-        } else {
-            // The buffer ended on a carriage return, we'll pick up looking for the line feed after
-            // the next read.
-            carriageReturnFound = true;
-            return false;
-        }
-    } else {
-        // No carriage return so far, stash what we have so far in the line.
-        inputLine.append(buffer, bufferPos, bufferPos + remaining);
-        bufferPos = 0;
-        remaining = 0;
+    // The tag follows the leading '$' or '!', and may wrap around the end of the ring.
+    char tagChars[tagLength];
+    for (size_t tagPos = 0; tagPos < tagLength; tagPos++) {
+        tagChars[tagPos] = ring[(lineStart + 1 + tagPos) & ringMask];
+    }
+
+    return sentenceFilter->accepts(tagChars);
+}
+
+bool NMEASource::isDuplicate(size_t lineStart, size_t lineLength, uint8_t lineXOR) {
+    const size_t tagLength = 5;
+    if (duplicateSuppressor == NULL || lineLength < 1 + tagLength) {
         return false;
     }
+
+    char tagChars[tagLength];
+    for (size_t tagPos = 0; tagPos < tagLength; tagPos++) {
+        tagChars[tagPos] = ring[(lineStart + 1 + tagPos) & ringMask];
+    }
+
+    return duplicateSuppressor->isDuplicate(duplicateSourceIndex, tagChars, lineLength, lineXOR);
 }
 
-bool NMEASource::readAvailableInput() {
-    const size_t available = stream.available();
-    if (available) {
-        const size_t readLength = min(available, maxNMEALineLength);
-        remaining = stream.readBytes(buffer, readLength);
-        if (readLength != remaining) {
-            logger << logWarning << "Truncated NMEA serial read" << eol;
+// Looks for a complete, CR/LF terminated, line in the ring. If one is found, inputLine is set to
+// it, the ring indices are moved past it, and true is returned.
+bool NMEASource::frameLine() {
+    size_t carriageReturnIndex;
+    while (scanForCarriageReturn(carriageReturnIndex)) {
+        // Since NMEA 0183 has CR/LF terminated lines, the carriage return should be followed by a
+        // line feed. If the line feed hasn't arrived yet, leave the scan on the carriage return
+        // and check again after the next read.
+        if (carriageReturnIndex + 1 == writeIndex) {
+            return false;
+        }
+
+        const size_t lineStart = lineStartIndex & ringMask;
+        const size_t lineLength = carriageReturnIndex - lineStartIndex;
+
+        if (!isLineFeed(ring[(carriageReturnIndex + 1) & ringMask])) {
+            // We had a carriage return without the associated line feed. Toss out the line and
+            // the carriage return and carry on from there.
+            LOG(logWarning) << "NMEA line with CR, but no LF. Ignoring." << eol;
+            lineStartIndex = scanIndex = carriageReturnIndex + 1;
+            lineXOR = 0;
+            discardingLine = false;
+            continue;
         }
-        bufferPos = 0;
 
+        const uint8_t completedLineXOR = lineXOR;
+        lineStartIndex = scanIndex = carriageReturnIndex + 2;
+        lineXOR = 0;
+
+        if (discardingLine) {
+            // This is the tail end of an overlength line which was already reported.
+            discardingLine = false;
+            continue;
+        }
+
+        // A line can arrive complete, CR/LF and all, without ever having been caught by the length
+        // check below. It must be dropped before it's copied out of the ring, as the space after
+        // the ring only has room for the wrapped part of a legal line.
+        if (lineLength > maxNMEALineLength) {
+            overlengthLine();
+            continue;
+        }
+
+        // Sentences that nothing wants are dropped here, before any more work is done on them.
+        if (!filterAccepts(lineStart, lineLength)) {
+            continue;
+        }
+
+        // As are ones that another source sharing our duplicate suppressor has just delivered.
+        if (isDuplicate(lineStart, lineLength, completedLineXOR)) {
+            continue;
+        }
+
+        // If the line wraps around the end of the ring, copy the wrapped part to the space after
+        // the ring so that the line can be handed out as a contiguous view.
+        if (lineStart + lineLength > ringSize) {
+            memcpy(ring + ringSize, ring, lineStart + lineLength - ringSize);
+        }
+
+        inputLine.set(ring + lineStart, lineLength, completedLineXOR);
         return true;
-    } else {
-        return false;
     }
+
+    // No complete line. If what we have so far couldn't possibly be a legal line, toss it out and
+    // ignore everything up through the next carriage return.
+    if (writeIndex - lineStartIndex > maxNMEALineLength) {
+        if (!discardingLine) {
+            overlengthLine();
+            discardingLine = true;
+        }
+        lineStartIndex = writeIndex;
+        lineXOR = 0;
+    }
+
+    return false;
+}
+
+void NMEASource::overlengthLine() {
+    LOG(logWarning) << "NMEA line longer than " << (uint32_t)maxNMEALineLength
+                    << " characters. Ignoring." << eol;
+    overlengthLines++;
+}
+
+size_t NMEASource::readAvailableInput() {
+    const size_t available = stream.available();
+    if (!available) {
+        unreadStreamBytes = 0;
+        return 0;
+    }
+
+    // Reads go straight into the ring, but only up to its end. Anything beyond that will be picked
+    // up on the next read.
+    const size_t writePos = writeIndex & ringMask;
+    const size_t freeSpace = ringSize - (writeIndex - lineStartIndex);
+    const size_t readLength = min(available, min(freeSpace, ringSize - writePos));
+    size_t bytesRead = 0;
+    if (readLength) {
+        bytesRead = stream.readBytes(ring + writePos, readLength);
+        if (bytesRead != readLength) {
+            LOG(logWarning) << "Truncated NMEA serial read" << eol;
+        }
+        writeIndex += bytesRead;
+    }
+    unreadStreamBytes = available - bytesRead;
+
+    return bytesRead;
 }
 
 void NMEASource::lineCompleted() {
@@ -164,7 +271,9 @@ void NMEASource::lineCompleted() {
 
     NMEAMessage *nmeaMessage = parseNMEAMessage(inputLine);
     if (nmeaMessage != NULL) {
-        nmeaMessage->log();
+        if (LOG_ENABLED(logDebugNMEA)) {
+            nmeaMessage->log();
+        }
 
         for (NMEAMessageHandler *messageHandler : messageHandlers) {
             messageHandler->processMessage(nmeaMessage);
@@ -177,23 +286,53 @@ void NMEASource::lineCompleted() {
     }
 }
 
+// Drains as much of the input as the budget allows, reading again whenever the ring runs out of
+// complete lines, so that a burst of sentences (such as a GSV group) is handled in one pass instead
+// of sitting in the serial receive buffer while the rest of the loop runs. If the budget runs out
+// first, the remaining input is left for the next call.
 void NMEASource::service() {
-    if (remaining) {
-        if (processBuffer()) {
+    const uint32_t startMicroseconds = micros();
+    unsigned linesProcessed = 0;
+    bool budgetExhausted = false;
+
+    while (readAvailableInput() || scanIndex != writeIndex) {
+        while (frameLine()) {
             lineCompleted();
-            inputLine.reset();
-            return;
+            linesProcessed++;
+            if (linesProcessed >= maxLinesPerService) {
+                budgetExhausted = true;
+                break;
+            }
         }
-    }
 
-    if (readAvailableInput()) {
-        if (processBuffer()) {
-            lineCompleted();
-            inputLine.reset();
+        if (budgetExhausted || micros() - startMicroseconds >= maxMicrosecondsPerService) {
+            budgetExhausted = true;
+            break;
         }
+
+        if (!unreadStreamBytes) {
+            break;
+        }
+    }
+
+    // Reaching the limit only counts as running out of budget if there was input left for it.
+    if (budgetExhausted && (unreadStreamBytes || scanIndex != writeIndex)) {
+        budgetExhaustions++;
+    }
+
+    const size_t backlog = unreadStreamBytes + (writeIndex - lineStartIndex);
+    if (backlog > peakBacklog) {
+        peakBacklog = backlog;
     }
 }
 
 void NMEASource::exportStats(uint32_t msElapsed) {
     messagesCounter.update(messageCountDataModelLeaf, messageRateDataModelLeaf, msElapsed);
+
+    // The backlog is the most input that was left waiting at the end of a service call during the
+    // interval.
+    backlogDataModelLeaf << (uint32_t)peakBacklog;
+    peakBacklog = 0;
+    budgetExhaustionsDataModelLeaf << budgetExhaustions;
+    overlengthLinesDataModelLeaf << overlengthLines;
 }
@@ -20,6 +20,8 @@
 #define NMEA_SOURCE_H
 
 class NMEAMessageHandler;
+class NMEASentenceFilter;
+class NMEADuplicateSuppressor;
 class DataModelLeaf;
 class StatsManager;
 
@@ -32,32 +34,70 @@ class StatsManager;
 
 #include <Stream.h>
 
+#include <stdint.h>
 #include <stddef.h>
 
 class NMEASource : public StatsHolder {
     private:
+        // Input is read straight into a ring buffer and lines are handed to NMEALine as views into
+        // it. The ring size must be a power of two. It is followed by enough space for a maximum
+        // length line so that a line which wraps around the end of the ring can be made contiguous
+        // by copying its wrapped portion there. The indices are free running and masked on use.
+        static const size_t ringSize = 256;
+        static const size_t ringMask = ringSize - 1;
+        // Default limits on how much work a single service() call will do before returning to the
+        // main loop, so that one busy source can't starve the others or the MQTT Broker.
+        static const unsigned defaultMaxLinesPerService = 16;
+        static const uint32_t defaultMaxMicrosecondsPerService = 4000;
+
         Stream &stream;
-        char buffer[maxNMEALineLength];
-        size_t bufferPos;
-        size_t remaining;
-        bool carriageReturnFound;
+        char ring[ringSize + maxNMEALineLength] __attribute__((aligned(4)));
+        size_t lineStartIndex;
+        size_t scanIndex;
+        size_t writeIndex;
+        // Running XOR of the characters of the current line scanned so far, used for checking the
+        // line's checksum without another pass over it.
+        uint8_t lineXOR;
+        bool discardingLine;
         NMEALine inputLine;
+        unsigned maxLinesPerService;
+        uint32_t maxMicrosecondsPerService;
+        // Bytes that the stream said were available, but weren't read, on the last read.
+        size_t unreadStreamBytes;
         static const size_t maxMessageHandlers = 5;
         etl::vector<NMEAMessageHandler *, maxMessageHandlers> messageHandlers;
+        NMEASentenceFilter *sentenceFilter;
+        NMEADuplicateSuppressor *duplicateSuppressor;
+        uint8_t duplicateSourceIndex;
         StatCounter messagesCounter;
         DataModelLeaf &messageCountDataModelLeaf;
         DataModelLeaf &messageRateDataModelLeaf;
+        size_t peakBacklog;
+        uint32_t budgetExhaustions;
+        DataModelLeaf &backlogDataModelLeaf;
+        DataModelLeaf &budgetExhaustionsDataModelLeaf;
+        uint32_t overlengthLines;
+        DataModelLeaf &overlengthLinesDataModelLeaf;
 
-        bool scanForCarriageReturn(size_t &carriageReturnPos);
-        bool readAvailableInput();
-        bool processBuffer();
+        bool scanForCarriageReturn(size_t &carriageReturnIndex);
+        size_t readAvailableInput();
+        bool filterAccepts(size_t lineStart, size_t lineLength);
+        bool isDuplicate(size_t lineStart, size_t lineLength, uint8_t lineXOR);
+        bool frameLine();
+        void overlengthLine();
         void lineCompleted();
         void updateStats();
 
     public:
         NMEASource(Stream &stream, DataModelLeaf &messageCountDataModelLeaf,
-                   DataModelLeaf &messageRateDataModelLeaf, StatsManager &statsManager);
+                   DataModelLeaf &messageRateDataModelLeaf, DataModelLeaf &backlogDataModelLeaf,
+                   DataModelLeaf &budgetExhaustionsDataModelLeaf,
+                   DataModelLeaf &overlengthLinesDataModelLeaf, StatsManager &statsManager);
         void addMessageHandler(NMEAMessageHandler &messageHandler);
+        void setSentenceFilter(NMEASentenceFilter &sentenceFilter);
+        void setDuplicateSuppressor(NMEADuplicateSuppressor &duplicateSuppressor,
+                                    DataModelLeaf &duplicatesDataModelLeaf, bool preferred = false);
+        void setServiceBudget(unsigned maxLines, uint32_t maxMicroseconds);
         void service();
         virtual void exportStats(uint32_t msElapsed) override;
 };
@@ -34,7 +34,7 @@ NMEATXTMessage::NMEATXTMessage(NMEATalker &talker) : NMEAMessage(talker) {
 
 bool NMEATXTMessage::parse(NMEALine &nmeaLine) {
     if (nmeaLine.isEncapsulatedData()) {
-        logger << logWarning << talker << " TXT message in unsupported encapsulated format" << eol;
+        LOG(logWarning) << talker << " TXT message in unsupported encapsulated format" << eol;
         return false;
     }
 
@@ -52,7 +52,7 @@ bool NMEATXTMessage::parse(NMEALine &nmeaLine) {
 
     etl::string_view textView;
     if (!nmeaLine.getWord(textView)) {
-        logger << logWarning << talker << " TXT message missing Text field" << eol;
+        LOG(logWarning) << talker << " TXT message missing Text field" << eol;
         return false;
     }
     text.assign(textView.begin(), textView.end());
@@ -63,15 +63,15 @@ bool NMEATXTMessage::parse(NMEALine &nmeaLine) {
 bool NMEATXTMessage::getTwoDigitField(NMEALine &nmeaLine, uint8_t &value, const char *fieldName) {
     etl::string_view valueView;
     if (!nmeaLine.getWord(valueView)) {
-        logger << logWarning << talker << " TXT message missing " << fieldName << " field" << eol;
+        LOG(logWarning) << talker << " TXT message missing " << fieldName << " field" << eol;
         return false;
     }
 
     etl::to_arithmetic_result<uint8_t> conversionResult;
     conversionResult = etl::to_arithmetic<uint8_t>(valueView);
     if (!conversionResult.has_value()) {
-        logger << logWarning << talker << " TXT message with bad " << fieldName << " field '"
-               << valueView << "'" << eol;
+        LOG(logWarning) << talker << " TXT message with bad " << fieldName << " field '"
+                        << valueView << "'" << eol;
         return false;
     }
     value = conversionResult.value();
@@ -83,8 +83,8 @@ enum NMEAMsgType NMEATXTMessage::type() const {
 }
 
 void NMEATXTMessage::log() const {
-    logger << logDebugNMEA << talker << " TXT: TotalSentences " << totalSentences << " Sentence "
-           << sentenceNumber << " TextId " << textIdentifier << " " << text << eol;
+    LOG(logDebugNMEA) << talker << " TXT: TotalSentences " << totalSentences << " Sentence "
+                      << sentenceNumber << " TextId " << textIdentifier << " " << text << eol;
 }
 
 NMEATXTMessage *parseNMEATXTMessage(NMEATalker &talker, NMEALine &nmeaLine) {
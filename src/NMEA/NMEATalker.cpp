@@ -19,9 +19,8 @@
 #include "NMEATalker.h"
 
 #include "Util/Logger.h"
-#include "Util/Error.h"
 
-#include <etl/string.h>
+#include <stdint.h>
 
 typedef struct {
     const char code[3];
@@ -146,25 +145,24 @@ static const TalkerTableEntry talkerTable[] = {
     { "", NULL }
 };
 
-NMEATalker::NMEATalker(const etl::istring &talkerCode) {
-
-    if (talkerCode.truncated() || talkerCode.size() != 2) {
-        fatalError("Bad parsing of the NMEA Talker Code");
-    }
+NMEATalker::NMEATalker(const char *talkerChars)
+    : talkerCode(nmeaTalkerCode(talkerChars[0], talkerChars[1])) {
+}
 
-    this->talkerCode = talkerCode;
+uint16_t NMEATalker::code() const {
+    return talkerCode;
 }
 
 const char *NMEATalker::name() const {
     unsigned tableEntryIndex;
     for (tableEntryIndex = 0; talkerTable[tableEntryIndex].code[0] != 0; tableEntryIndex++) {
         const TalkerTableEntry &tableEntry = talkerTable[tableEntryIndex];
-        if (tableEntry.code[0] == talkerCode[0] && tableEntry.code[1] == talkerCode[1]) {
+        if (nmeaTalkerCode(tableEntry.code[0], tableEntry.code[1]) == talkerCode) {
             return tableEntry.description;
         }
     }
 
-    if (talkerCode[0] == 'P') {
+    if ((talkerCode >> 8) == 'P') {
         return "Proprietary";
     }
 
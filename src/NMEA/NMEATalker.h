@@ -22,14 +22,21 @@
 #include "Util/LoggableItem.h"
 #include "Util/Logger.h"
 
-#include <etl/string.h>
+#include <stdint.h>
+
+// The two character talker code of an NMEA tag packed into an integer, first character in the most
+// significant byte.
+constexpr uint16_t nmeaTalkerCode(char first, char second) {
+    return ((uint16_t)(uint8_t)first << 8) | (uint8_t)second;
+}
 
 class NMEATalker : public LoggableItem {
     private:
-        etl::string<2> talkerCode;
+        uint16_t talkerCode;
 
     public:
-        NMEATalker(const etl::istring &talkerCode);
+        NMEATalker(const char *talkerChars);
+        uint16_t code() const;
         const char *name() const;
         virtual void log(Logger &logger) const override;
 };
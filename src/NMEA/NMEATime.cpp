@@ -22,58 +22,80 @@
 
 #include "DataModel/DataModelStringLeaf.h"
 
+#include "Util/CharacterTools.h"
 #include "Util/Logger.h"
 #include "Util/StringTools.h"
+#include "Util/TimeConstants.h"
 
 #include <etl/string.h>
 #include <etl/string_stream.h>
 #include <etl/string_view.h>
 
+#include <stdint.h>
+#include <Arduino.h>
+
 bool NMEATime::set(const etl::string_view &timeView) {
     if (timeView.size() < 6) {
         return false;
     }
 
-    etl::string_view hoursView(timeView.begin(), 2);
+    uint8_t hours;
     if (!extractUInt8FromStringView(timeView, 0, 2, hours, 23)) {
         return false;
     }
 
+    uint8_t minutes;
     if (!extractUInt8FromStringView(timeView, 2, 2, minutes, 59)) {
         return false;
     }
 
+    uint8_t seconds;
     if (!extractUInt8FromStringView(timeView, 4, 2, seconds, 59)) {
         return false;
     }
 
+    uint16_t milliSeconds = 0;
+    uint8_t precision = 0;
     if (timeView.size() > 6) {
-        if (timeView[6] != '.') {
+        if (timeView[6] != '.' || timeView.size() == 7) {
             return false;
         }
 
-        secondPrecision = timeView.size() - 7;
-        if (!extractUInt32FromStringView(timeView, 7, secondPrecision, secondFraction)) {
-            return false;
+        uint16_t scale = msInSecond;
+        for (size_t position = 7; position < timeView.size(); position++) {
+            const char character = timeView[position];
+            if (!isDigit(character)) {
+                return false;
+            }
+            if (scale > 1) {
+                scale /= 10;
+                milliSeconds += decimalValue(character) * scale;
+                precision++;
+            }
         }
-    } else {
-        secondFraction = 0;
-        secondPrecision = 0;
     }
 
+    milliSecondOfDay = ((hours * 60ul + minutes) * 60ul + seconds) * msInSecond + milliSeconds;
+    secondPrecision = precision;
+
     return true;
 }
 
 bool NMEATime::extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType) {
     etl::string_view timeView;
     if (!nmeaLine.getWord(timeView)) {
-        logger << logWarning << talker << " " << msgType << " message missing Time field" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message missing Time field" << eol;
         return false;
     }
 
+    return setField(timeView, talker, msgType);
+}
+
+bool NMEATime::setField(const etl::string_view &timeView, NMEATalker &talker,
+                        const char *msgType) {
     if (!set(timeView)) {
-        logger << logWarning << talker << " " << msgType << " message with bad Time field '"
-               << timeView << "'" << eol;
+        LOG(logWarning) << talker << " " << msgType << " message with bad Time field '"
+                        << timeView << "'" << eol;
         return false;
     }
 
@@ -81,47 +103,46 @@ bool NMEATime::extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgTy
 }
 
 void NMEATime::publish(DataModelStringLeaf &leaf) const {
-    char secondFractionStr[12];
-    buildSecondsFactionString(secondFractionStr);
-
-    etl::string<22> timeStr;
-    etl::string_stream timeStrStream(timeStr);
-    timeStrStream << etl::setfill('0') << etl::setw(2) << hours << etl::setw(1) << ":"
-                  << etl::setw(2) << minutes << etl::setw(1) << ":" << etl::setw(2) << seconds
-                  << etl::setw(0) << secondFractionStr;
+    etl::string<12> timeStr;
+    format(timeStr);
 
     leaf = timeStr;
 }
 
-void NMEATime::buildSecondsFactionString(char *string) const {
-    if (secondPrecision > 0) {
-        *string = '.';
-        string++;
+uint32_t NMEATime::milliSecondsOfDay() const {
+    return milliSecondOfDay;
+}
 
-        char fractionDigits[11];
-        sprintf(fractionDigits, "%lu", secondFraction);
+bool NMEATime::operator == (const NMEATime &other) const {
+    return milliSecondOfDay == other.milliSecondOfDay &&
+           secondPrecision == other.secondPrecision;
+}
 
-        unsigned leadingZeros = secondPrecision - strlen(fractionDigits);
-        while (leadingZeros--) {
-            *string = '0';
-            string++;
-        }
+bool NMEATime::operator != (const NMEATime &other) const {
+    return !(*this == other);
+}
+
+void NMEATime::format(etl::istring &timeStr) const {
+    const uint32_t secondOfDay = milliSecondOfDay / msInSecond;
+
+    timeStr.clear();
+    etl::string_stream timeStrStream(timeStr);
+    timeStrStream << etl::setfill('0') << etl::setw(2) << secondOfDay / 3600 << etl::setw(1)
+                  << ":" << etl::setw(2) << secondOfDay / 60 % 60 << etl::setw(1) << ":"
+                  << etl::setw(2) << secondOfDay % 60;
 
-        strcpy(string, fractionDigits);
-    } else {
-        *string = 0;
+    if (secondPrecision > 0) {
+        uint32_t fraction = milliSecondOfDay % msInSecond;
+        for (uint8_t digit = secondPrecision; digit < maxSecondPrecision; digit++) {
+            fraction /= 10;
+        }
+        timeStrStream << etl::setw(1) << "." << etl::setw(secondPrecision) << fraction;
     }
 }
 
 void NMEATime::log(Logger &logger) const {
-    char secondFractionStr[12];
-    buildSecondsFactionString(secondFractionStr);
-
-    etl::string<22> timeStr;
-    etl::string_stream timeStrStream(timeStr);
-    timeStrStream << etl::setfill('0') << etl::setw(2) << hours << etl::setw(1) << ":"
-                  << etl::setw(2) << minutes << etl::setw(1) << ":" << etl::setw(2) << seconds
-                  << etl::setw(0) << secondFractionStr;
+    etl::string<12> timeStr;
+    format(timeStr);
 
     logger << timeStr;
 }
@@ -27,25 +27,32 @@
 #include "Util/LoggableItem.h"
 #include "Util/Logger.h"
 
+#include <etl/string.h>
 #include <etl/string_view.h>
 
 #include <stdint.h>
 
+// A UTC time of day, kept as the milliseconds since midnight so that it can be compared and turned
+// into a UTCTimestamp without any arithmetic on separate fields. Digits after the milliseconds are
+// dropped, but the number of fraction digits sent is remembered so that the time is shown with
+// the same precision as it arrived.
 class NMEATime : public LoggableItem {
     private:
-        uint8_t hours;
-        uint8_t minutes;
-        uint8_t seconds;
-        uint8_t secondPrecision;
-        uint32_t secondFraction;
+        static const uint8_t maxSecondPrecision = 3;
 
-        void buildSecondsFactionString(char *string) const;
+        uint32_t milliSecondOfDay;
+        uint8_t secondPrecision;
 
         bool set(const etl::string_view &timeView);
+        void format(etl::istring &timeStr) const;
 
     public:
         bool extract(NMEALine &nmeaLine, NMEATalker &talker, const char *msgType);
+        bool setField(const etl::string_view &timeView, NMEATalker &talker, const char *msgType);
         void publish(DataModelStringLeaf &leaf) const;
+        uint32_t milliSecondsOfDay() const;
+        bool operator == (const NMEATime &other) const;
+        bool operator != (const NMEATime &other) const;
         virtual void log(Logger &logger) const override;
 };
 
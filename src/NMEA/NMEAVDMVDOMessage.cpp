@@ -19,8 +19,7 @@
 #include "NMEAVDMVDOMessage.h"
 #include "NMEATalker.h"
 #include "NMEALine.h"
-#include "NMEAUInt8.h"
-#include "NMEAUInt16.h"
+#include "NMEAFixedPoint.h"
 #include "NMEARadioChannelCode.h"
 #include "NMEAMsgType.h"
 #include "NMEAMessageBuffer.h"
@@ -34,8 +33,8 @@ NMEAVDMVDOMessage::NMEAVDMVDOMessage(NMEATalker &talker, NMEAMsgType &msgType)
 
 bool NMEAVDMVDOMessage::parse(NMEALine &nmeaLine) {
     if (!nmeaLine.isEncapsulatedData()) {
-        logger << logWarning << talker << " " << msgTypeName()
-               << " message in unsupported, non-encapsulated format" << eol;
+        LOG(logWarning) << talker << " " << msgTypeName()
+                        << " message in unsupported, non-encapsulated format" << eol;
         return false;
     }
 
@@ -55,6 +54,16 @@ bool NMEAVDMVDOMessage::parse(NMEALine &nmeaLine) {
         return false;
     }
 
+    if (!nmeaLine.getWord(payload) || payload.empty()) {
+        LOG(logWarning) << talker << " " << msgTypeName() << " message missing Payload"
+                        << eol;
+        return false;
+    }
+
+    if (!fillBits.extract(nmeaLine, talker, msgTypeName(), "Fill Bits", false, 5)) {
+        return false;
+    }
+
     return true;
 }
 
@@ -67,8 +76,9 @@ const char *NMEAVDMVDOMessage::msgTypeName() const {
 }
 
 void NMEAVDMVDOMessage::log() const {
-    logger << logDebugNMEA << talker << " " << msgTypeName() << ": " << fragmentNumber << " of "
-           << totalFragments << " Msg Id " << messageId << " Channel " << radioChannelCode << eol;
+    LOG(logDebugNMEA) << talker << " " << msgTypeName() << ": " << fragmentNumber << " of "
+                      << totalFragments << " Msg Id " << messageId << " Channel "
+                      << radioChannelCode << eol;
 }
 
 bool NMEAVDMVDOMessage::isOwnShip() const {
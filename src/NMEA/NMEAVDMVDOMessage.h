@@ -20,13 +20,14 @@
 #define NMEA_VDMVDO_MESSAGE_H
 
 #include "NMEAMessage.h"
-#include "NMEAUInt8.h"
-#include "NMEAUInt16.h"
+#include "NMEAFixedPoint.h"
 #include "NMEARadioChannelCode.h"
 #include "NMEATalker.h"
 #include "NMEALine.h"
 #include "NMEAMsgType.h"
 
+#include <etl/string_view.h>
+
 class NMEAVDMVDOMessage : public NMEAMessage {
     private:
         NMEAMsgType msgType;
@@ -34,6 +35,10 @@ class NMEAVDMVDOMessage : public NMEAMessage {
         NMEAUInt8 fragmentNumber;
         NMEAUInt16 messageId;
         NMEARadioChannelCode radioChannelCode;
+        // The armored AIS payload, still in place in the line, and the number of bits of padding
+        // at the end of it.
+        etl::string_view payload;
+        NMEAUInt8 fillBits;
 
         const char *msgTypeName() const;
 
@@ -45,6 +50,7 @@ class NMEAVDMVDOMessage : public NMEAMessage {
         bool isOwnShip() const;
 
     friend class NMEADataModelBridge;
+    friend class AISDecoder;
 };
 
 extern NMEAVDMVDOMessage *parseNMEAVDMVDOMessage(NMEATalker &talker, NMEAMsgType &msgType,
@@ -17,7 +17,7 @@
  */
 
 #include "NMEAVTGMessage.h"
-#include "NMEATenthsUInt16.h"
+#include "NMEAFixedPoint.h"
 #include "NMEAFAAModeIndicator.h"
 #include "NMEATalker.h"
 #include "NMEALine.h"
@@ -33,7 +33,7 @@ NMEAVTGMessage::NMEAVTGMessage(NMEATalker &talker) : NMEAMessage(talker) {
 
 bool NMEAVTGMessage::parse(NMEALine &nmeaLine) {
     if (nmeaLine.isEncapsulatedData()) {
-        logger << logWarning << talker << " VTG message in unsupported encapsulated format" << eol;
+        LOG(logWarning) << talker << " VTG message in unsupported encapsulated format" << eol;
         return false;
     }
 
@@ -45,22 +45,21 @@ bool NMEAVTGMessage::parse(NMEALine &nmeaLine) {
     // with out.
     etl::string_view secondWordView;
     if (!nmeaLine.getWord(secondWordView)) {
-        logger << logError << talker << " VTG message missing second field" << eol;
+        LOG(logError) << talker << " VTG message missing second field" << eol;
         return false;
     }
 
     bool oldForm = !wordIsT(secondWordView);
     if (!oldForm) {
         if (!nmeaLine.getWord(secondWordView)) {
-            logger << logError << talker << " VTG message missing Course Over Ground, Magnetic "
-                   << eol;
+            LOG(logError) << talker << " VTG message missing Course Over Ground, Magnetic "
+                          << eol;
             return false;
         }
     }
 
-    if (!trackMadeGoodMagnetic.set(secondWordView, true)) {
-        logger << logError << talker << " VTG message with a bad Course Over Ground, Magentic"
-               << "'" << secondWordView << "'" << eol;
+    if (!trackMadeGoodMagnetic.setField(secondWordView, talker, "VTG",
+                                        "Course Over Ground, Magnetic", true)) {
         return false;
     }
 
@@ -20,7 +20,7 @@
 #define NMEA_VTG_MESSAGE_H
 
 #include "NMEAMessage.h"
-#include "NMEATenthsUInt16.h"
+#include "NMEAFixedPoint.h"
 #include "NMEAFAAModeIndicator.h"
 #include "NMEATalker.h"
 #include "NMEALine.h"
@@ -0,0 +1,156 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GSVSatellite.h"
+
+#include "DataModel/DataModelSlotNode.h"
+#include "DataModel/DataModelInt8Leaf.h"
+#include "DataModel/DataModelUInt8Leaf.h"
+#include "DataModel/DataModelUInt16Leaf.h"
+
+#include <etl/string.h>
+#include <etl/to_string.h>
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+GSVSatellite::GSVSatellite()
+    : node(prnName, NULL, children),
+      elevationLeaf("elevation", &node),
+      azimuthLeaf("azimuth", &node),
+      signalToNoiseRatioLeaf("snr", &node),
+      prn(0), elevation(elevationNotAvailable), azimuth(azimuthNotAvailable),
+      signalToNoiseRatio(signalToNoiseRatioNotAvailable), changes(0), seen(false) {
+    prnName[0] = 0;
+
+    children[0] = &elevationLeaf;
+    children[1] = &azimuthLeaf;
+    children[2] = &signalToNoiseRatioLeaf;
+    children[leafCount] = NULL;
+}
+
+DataModelElement *GSVSatellite::dataModelNode() {
+    return &node;
+}
+
+bool GSVSatellite::inUse() const {
+    return prn != 0;
+}
+
+uint16_t GSVSatellite::satellitePRN() const {
+    return prn;
+}
+
+bool GSVSatellite::seenInGroup() const {
+    return seen;
+}
+
+void GSVSatellite::startGroup() {
+    seen = false;
+}
+
+// Takes a free slot over for a newly seen satellite. The node is renamed when the group is
+// committed.
+void GSVSatellite::assign(uint16_t prn) {
+    this->prn = prn;
+    changes = CHANGED_IDENTITY;
+    elevation = elevationNotAvailable;
+    azimuth = azimuthNotAvailable;
+    signalToNoiseRatio = signalToNoiseRatioNotAvailable;
+}
+
+// Empties the slot once its satellite has dropped out of view, clearing the retained values so
+// that subscribers see it go. Subscriptions naming the satellite's PRN go with it, so that they
+// aren't carried over to whichever satellite takes the slot next.
+void GSVSatellite::release() {
+    clearValues();
+    node.dropNamedSubscriptions();
+
+    prn = 0;
+    prnName[0] = 0;
+    changes = 0;
+    seen = false;
+}
+
+// The removals are published straight away, while the node still has the satellite's PRN as its
+// name.
+void GSVSatellite::clearValues() {
+    elevationLeaf.removeValueNow();
+    azimuthLeaf.removeValueNow();
+    signalToNoiseRatioLeaf.removeValueNow();
+}
+
+void GSVSatellite::update(int8_t elevation, uint16_t azimuth, uint8_t signalToNoiseRatio) {
+    seen = true;
+
+    if (elevation != this->elevation) {
+        this->elevation = elevation;
+        changes |= CHANGED_ELEVATION;
+    }
+    if (azimuth != this->azimuth) {
+        this->azimuth = azimuth;
+        changes |= CHANGED_AZIMUTH;
+    }
+    if (signalToNoiseRatio != this->signalToNoiseRatio) {
+        this->signalToNoiseRatio = signalToNoiseRatio;
+        changes |= CHANGED_SNR;
+    }
+}
+
+void GSVSatellite::publish() {
+    if (!changes) {
+        return;
+    }
+
+    if (changes & CHANGED_IDENTITY) {
+        etl::string<prnNameLength> prnStr;
+        etl::to_string(prn, prnStr);
+        strcpy(prnName, prnStr.c_str());
+        node.bindNamedSubscriptions();
+
+        changes = CHANGED_ALL;
+    }
+
+    if (changes & CHANGED_ELEVATION) {
+        if (elevation == elevationNotAvailable) {
+            elevationLeaf.removeValue();
+        } else {
+            elevationLeaf = elevation;
+        }
+    }
+
+    if (changes & CHANGED_AZIMUTH) {
+        if (azimuth == azimuthNotAvailable) {
+            azimuthLeaf.removeValue();
+        } else {
+            azimuthLeaf = azimuth;
+        }
+    }
+
+    // Satellites that are in view but not being tracked are sent without a signal to noise ratio.
+    if (changes & CHANGED_SNR) {
+        if (signalToNoiseRatio == signalToNoiseRatioNotAvailable) {
+            signalToNoiseRatioLeaf.removeValue();
+        } else {
+            signalToNoiseRatioLeaf = signalToNoiseRatio;
+        }
+    }
+
+    changes = 0;
+}
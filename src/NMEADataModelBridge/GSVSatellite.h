@@ -0,0 +1,80 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GSV_SATELLITE_H
+#define GSV_SATELLITE_H
+
+#include "DataModel/DataModelSlotNode.h"
+#include "DataModel/DataModelInt8Leaf.h"
+#include "DataModel/DataModelUInt8Leaf.h"
+#include "DataModel/DataModelUInt16Leaf.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// One slot of a GSV satellite table. Each slot has its own Data Model node under the table's
+// constellation, named with the PRN of the satellite currently held in the slot. Values are staged
+// as GSV sentences arrive, with flags noting which changed, and go out to the Data Model when the
+// table commits the group.
+class GSVSatellite {
+    private:
+        enum Change : uint8_t {
+            CHANGED_ELEVATION = 0x01,
+            CHANGED_AZIMUTH = 0x02,
+            CHANGED_SNR = 0x04,
+            CHANGED_IDENTITY = 0x08,
+            CHANGED_ALL = 0x0f
+        };
+
+        static const size_t prnNameLength = 5;
+        static const size_t leafCount = gsvSatelliteLeaves;
+
+        char prnName[prnNameLength + 1];
+        DataModelElement *children[leafCount + 1];
+        DataModelSlotNode node;
+        DataModelInt8Leaf elevationLeaf;
+        DataModelUInt16Leaf azimuthLeaf;
+        DataModelUInt8Leaf signalToNoiseRatioLeaf;
+
+        uint16_t prn;
+        int8_t elevation;
+        uint16_t azimuth;
+        uint8_t signalToNoiseRatio;
+        uint8_t changes;
+        bool seen;
+
+        void clearValues();
+
+    public:
+        static const int8_t elevationNotAvailable = -128;
+        static const uint16_t azimuthNotAvailable = 0xffff;
+        static const uint8_t signalToNoiseRatioNotAvailable = 0xff;
+
+        GSVSatellite();
+        DataModelElement *dataModelNode();
+        bool inUse() const;
+        uint16_t satellitePRN() const;
+        bool seenInGroup() const;
+        void startGroup();
+        void assign(uint16_t prn);
+        void release();
+        void update(int8_t elevation, uint16_t azimuth, uint8_t signalToNoiseRatio);
+        void publish();
+};
+
+#endif
@@ -0,0 +1,121 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GSVSatelliteTable.h"
+#include "GSVSatellite.h"
+
+#include "DataModel/DataModel.h"
+#include "DataModel/DataModelNode.h"
+#include "DataModel/DataModelUInt8Leaf.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// The node's children are the in view count followed by the satellite slots.
+GSVSatelliteTable::GSVSatelliteTable(DataModelNode &node, DataModelElement **children)
+    : inViewLeaf("inView", &node), sentencesInGroup(0), nextSentence(0), satellitesInView(0),
+      satellitesDropped(0) {
+    children[0] = &inViewLeaf;
+    for (uint8_t slot = 0; slot < gpsMaxSatellitesInView; slot++) {
+        DataModelElement *satelliteNode = satellites[slot].dataModelNode();
+        satelliteNode->setParent(&node);
+        children[slot + 1] = satelliteNode;
+    }
+    children[gpsMaxSatellitesInView + 1] = NULL;
+}
+
+// Returns false if the sentence isn't the next one expected, in which case any group in progress
+// is abandoned.
+bool GSVSatelliteTable::startSentence(uint8_t sentencesInGroup, uint8_t sentenceNumber,
+                                      uint8_t satellitesInView) {
+    if (sentenceNumber == 1) {
+        this->sentencesInGroup = sentencesInGroup;
+        this->satellitesInView = satellitesInView;
+        nextSentence = 1;
+        for (uint8_t slot = 0; slot < gpsMaxSatellitesInView; slot++) {
+            satellites[slot].startGroup();
+        }
+    } else if (sentenceNumber != nextSentence || sentencesInGroup != this->sentencesInGroup) {
+        nextSentence = 0;
+        return false;
+    }
+
+    return true;
+}
+
+void GSVSatelliteTable::updateSatellite(uint16_t prn, int8_t elevation, uint16_t azimuth,
+                                        uint8_t signalToNoiseRatio) {
+    GSVSatellite *satellite = lookupOrAssign(prn);
+    if (satellite == NULL) {
+        satellitesDropped++;
+        return;
+    }
+
+    satellite->update(elevation, azimuth, signalToNoiseRatio);
+}
+
+void GSVSatelliteTable::endSentence() {
+    if (nextSentence == sentencesInGroup) {
+        commit();
+        nextSentence = 0;
+    } else {
+        nextSentence++;
+    }
+}
+
+uint32_t GSVSatelliteTable::dropped() const {
+    return satellitesDropped;
+}
+
+// A satellite that isn't in the table yet can only take a free slot, as the satellites that will
+// drop out of view aren't known until the whole group is in.
+GSVSatellite *GSVSatelliteTable::lookupOrAssign(uint16_t prn) {
+    GSVSatellite *freeSatellite = NULL;
+    for (uint8_t slot = 0; slot < gpsMaxSatellitesInView; slot++) {
+        GSVSatellite &satellite = satellites[slot];
+        if (satellite.satellitePRN() == prn) {
+            return &satellite;
+        }
+        if (freeSatellite == NULL && !satellite.inUse()) {
+            freeSatellite = &satellite;
+        }
+    }
+
+    if (freeSatellite != NULL) {
+        freeSatellite->assign(prn);
+    }
+
+    return freeSatellite;
+}
+
+void GSVSatelliteTable::commit() {
+    for (uint8_t slot = 0; slot < gpsMaxSatellitesInView; slot++) {
+        GSVSatellite &satellite = satellites[slot];
+        if (!satellite.inUse()) {
+            continue;
+        }
+
+        if (satellite.seenInGroup()) {
+            satellite.publish();
+        } else {
+            satellite.release();
+        }
+    }
+
+    inViewLeaf = satellitesInView;
+}
@@ -0,0 +1,56 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GSV_SATELLITE_TABLE_H
+#define GSV_SATELLITE_TABLE_H
+
+#include "GSVSatellite.h"
+
+#include "DataModel/DataModel.h"
+#include "DataModel/DataModelNode.h"
+#include "DataModel/DataModelUInt8Leaf.h"
+
+#include <stdint.h>
+
+// The satellites in view for one constellation, assembled from a group of GSV sentences. Each
+// sentence of a group is folded into the table as it arrives, and once the last one is in the
+// group is committed: satellites that weren't in the group give up their slots and only the
+// values that changed are published. A group with a sentence missing or out of order is dropped.
+class GSVSatelliteTable {
+    private:
+        GSVSatellite satellites[gpsMaxSatellitesInView];
+        DataModelUInt8Leaf inViewLeaf;
+        uint8_t sentencesInGroup;
+        uint8_t nextSentence;
+        uint8_t satellitesInView;
+        uint32_t satellitesDropped;
+
+        GSVSatellite *lookupOrAssign(uint16_t prn);
+        void commit();
+
+    public:
+        GSVSatelliteTable(DataModelNode &node, DataModelElement **children);
+        bool startSentence(uint8_t sentencesInGroup, uint8_t sentenceNumber,
+                           uint8_t satellitesInView);
+        void updateSatellite(uint16_t prn, int8_t elevation, uint16_t azimuth,
+                             uint8_t signalToNoiseRatio);
+        void endSentence();
+        uint32_t dropped() const;
+};
+
+#endif
@@ -17,20 +17,22 @@
  */
 
 #include "NMEADataModelBridge.h"
+#include "GSVSatellite.h"
+#include "GSVSatelliteTable.h"
 
 #include "NMEA/NMEAMessage.h"
 #include "NMEA/NMEAMsgType.h"
-#include "NMEA/NMEADBKMessage.h"
-#include "NMEA/NMEADBSMessage.h"
-#include "NMEA/NMEADBTMessage.h"
+#include "NMEA/NMEASentenceSchema.h"
+#include "NMEA/NMEASchemaMessage.h"
 #include "NMEA/NMEAGGAMessage.h"
 #include "NMEA/NMEAGLLMessage.h"
 #include "NMEA/NMEAGSAMessage.h"
-#include "NMEA/NMEAGSTMessage.h"
 #include "NMEA/NMEAGSVMessage.h"
+#include "NMEA/NMEAGSVSatelitteInfo.h"
 #include "NMEA/NMEARMCMessage.h"
 #include "NMEA/NMEAVDMVDOMessage.h"
 #include "NMEA/NMEAVTGMessage.h"
+#include "NMEA/NMEATalker.h"
 
 #include "DataModel/DataModel.h"
 
@@ -39,33 +41,179 @@
 
 #include "Util/PassiveTimer.h"
 #include "Util/Logger.h"
+#include "Util/TimeConstants.h"
+#include "Util/UTCTimestamp.h"
 
 #include <etl/string.h>
-#include <etl/string_stream.h>
 
 #include <stdint.h>
 
-NMEADataModelBridge::NMEADataModelBridge(StatsManager &statsManager) : messagesBridgedCounter() {
+NMEADataModelBridge::NMEADataModelBridge(StatsManager &statsManager)
+    : messagesBridgedCounter(), epochState(EPOCH_IDLE), epochSentences(0),
+      expectedEpochSentences(0), epochTimeoutMs(defaultEpochTimeoutMs), epochHasDataValid(false),
+      epochHasDate(false), epochDays(0), epochSpeedOverGround(), epochTrackMadeGoodTrue(),
+      epochHasActiveSatellites(false), lateActiveSatellites(false),
+      epochActiveSatellites(), publishedActiveSatellites(), hasTimestampDays(false), timestampDays(0),
+      lastMilliSecondOfDay(0), lastTimestamp(), epochsCommitted(0), epochTimeouts(0),
+      gpsSatellites(gpsSatellitesGPSNode, gpsSatellitesGPSNodeChildren),
+      glonassSatellites(gpsSatellitesGLONASSNode, gpsSatellitesGLONASSNodeChildren),
+      galileoSatellites(gpsSatellitesGalileoNode, gpsSatellitesGalileoNodeChildren),
+      beiDouSatellites(gpsSatellitesBeiDouNode, gpsSatellitesBeiDouNodeChildren) {
     statsManager.addStatsHolder(this);
 }
 
+NMEADataModelBridge::EpochTenthsUInt16::EpochTenthsUInt16()
+    : staged(false), present(false), wholeNumber(0), tenths(0) {
+}
+
+void NMEADataModelBridge::EpochTenthsUInt16::clear() {
+    staged = false;
+    present = false;
+}
+
+void NMEADataModelBridge::EpochTenthsUInt16::stage(const NMEATenthsUInt16 &field) {
+    if (field.hasValue()) {
+        wholeNumber = field.getValue();
+        tenths = field.getFraction();
+        present = true;
+    }
+    staged = true;
+}
+
+bool NMEADataModelBridge::EpochTenthsUInt16::isStaged() const {
+    return staged;
+}
+
+void NMEADataModelBridge::EpochTenthsUInt16::publish(DataModelTenthsUInt16Leaf &leaf) const {
+    if (present) {
+        leaf.set(wholeNumber, tenths);
+    } else {
+        leaf.removeValue();
+    }
+}
+
+void NMEADataModelBridge::setEpochTimeout(uint32_t milliSeconds) {
+    epochTimeoutMs = milliSeconds;
+}
+
+void NMEADataModelBridge::service() {
+    if (epochState == EPOCH_STAGING && epochTimer.expired()) {
+        epochTimeouts++;
+        commitEpoch();
+    } else if (lateActiveSatellites && epochTimer.expired()) {
+        publishActiveSatellites();
+        lateActiveSatellites = false;
+    }
+}
+
+// Returns true if the sentence's shared values should be staged, false if they belong to an epoch
+// that has already been committed and are being dropped.
+bool NMEADataModelBridge::stageEpochSentence(const NMEATime &time, EpochSentence sentence) {
+    if (epochState != EPOCH_IDLE && time == epochTime) {
+        if (epochState == EPOCH_COMMITTED) {
+            // A straggler from an epoch we've already committed, make sure we wait for it next
+            // time.
+            expectedEpochSentences |= sentence;
+            return false;
+        }
+    } else {
+        if (epochState == EPOCH_STAGING) {
+            commitEpoch();
+        } else if (lateActiveSatellites) {
+            publishActiveSatellites();
+            lateActiveSatellites = false;
+        }
+
+        epochState = EPOCH_STAGING;
+        epochTime = time;
+        epochSentences = 0;
+        epochHasDataValid = false;
+        epochHasDate = false;
+        epochSpeedOverGround.clear();
+        epochTrackMadeGoodTrue.clear();
+        epochHasActiveSatellites = false;
+        epochActiveSatellites.clear();
+        epochFAAModeIndicator = NMEAFAAModeIndicator();
+        epochTimer.setMilliSeconds(epochTimeoutMs);
+    }
+
+    epochSentences |= sentence;
+    return true;
+}
+
+void NMEADataModelBridge::completeEpochSentence() {
+    if (expectedEpochSentences &&
+        (epochSentences & expectedEpochSentences) == expectedEpochSentences) {
+        commitEpoch();
+    }
+}
+
+void NMEADataModelBridge::commitEpoch() {
+    epochTime.publish(gpsTime);
+    publishTimestamp();
+    epochLatitude.publish(gpsLatitude);
+    epochLongitude.publish(gpsLongitude);
+    if (epochHasDataValid) {
+        epochDataValid.publish(gpsDataValid);
+    }
+    if (epochFAAModeIndicator.hasValue()) {
+        epochFAAModeIndicator.publish(gpsFAAModeindicator);
+    }
+    if (epochSpeedOverGround.isStaged()) {
+        epochSpeedOverGround.publish(gpsSpeedOverGround);
+    }
+    if (epochTrackMadeGoodTrue.isStaged()) {
+        epochTrackMadeGoodTrue.publish(gpsTrackMadeGoodTrue);
+    }
+    if (epochHasActiveSatellites) {
+        publishActiveSatellites();
+    }
+
+    expectedEpochSentences = epochSentences;
+    epochState = EPOCH_COMMITTED;
+    epochsCommitted++;
+}
+
+// Only RMC sentences carry a date, so between them the day is carried forward from the last one,
+// moving on to the next day when the time of day wraps past midnight. The timestamp is only
+// formatted and published when it reaches a new second.
+void NMEADataModelBridge::publishTimestamp() {
+    const uint32_t milliSecondOfDay = epochTime.milliSecondsOfDay();
+    if (epochHasDate) {
+        timestampDays = epochDays;
+        hasTimestampDays = true;
+    } else if (hasTimestampDays && milliSecondOfDay + msInDay / 2 < lastMilliSecondOfDay) {
+        timestampDays++;
+    }
+    lastMilliSecondOfDay = milliSecondOfDay;
+
+    if (!hasTimestampDays) {
+        return;
+    }
+
+    const UTCTimestamp timestamp(timestampDays, milliSecondOfDay);
+    if (!timestamp.sameSecond(lastTimestamp)) {
+        etl::string<timestampLength> timestampStr;
+        timestamp.formatISO8601(timestampStr);
+        gpsTimestamp = timestampStr;
+    }
+    lastTimestamp = timestamp;
+}
+
+void NMEADataModelBridge::publishActiveSatellites() {
+    if (epochActiveSatellites != publishedActiveSatellites) {
+        etl::string<activeSatellitesLength> activeSatellitesStr;
+        epochActiveSatellites.format(activeSatellitesStr);
+        gpsActiveSatellites = activeSatellitesStr;
+        publishedActiveSatellites = epochActiveSatellites;
+    }
+}
+
 void NMEADataModelBridge::processMessage(NMEAMessage *message) {
     // Add a filter here so that messages with redundant content are having their content sent
     // unnecessarily.
     const NMEAMsgType msgType = message->type();
     switch (msgType) {
-        case NMEA_MSG_TYPE_DBK:
-            bridgeNMEADBKMessage((NMEADBKMessage *)message);
-            break;
-
-        case NMEA_MSG_TYPE_DBS:
-            bridgeNMEADBSMessage((NMEADBSMessage *)message);
-            break;
-
-        case NMEA_MSG_TYPE_DBT:
-            bridgeNMEADBTMessage((NMEADBTMessage *)message);
-            break;
-
         case NMEA_MSG_TYPE_GGA:
             bridgeNMEAGGAMessage((NMEAGGAMessage *)message);
             break;
@@ -78,10 +226,6 @@ void NMEADataModelBridge::processMessage(NMEAMessage *message) {
             bridgeNMEAGSAMessage((NMEAGSAMessage *)message);
             break;
 
-        case NMEA_MSG_TYPE_GST:
-            bridgeNMEAGSTMessage((NMEAGSTMessage *)message);
-            break;
-
         case NMEA_MSG_TYPE_RMC:
             bridgeNMEARMCMessage((NMEARMCMessage *)message);
             break;
@@ -91,48 +235,42 @@ void NMEADataModelBridge::processMessage(NMEAMessage *message) {
             break;
 
         case NMEA_MSG_TYPE_GSV:
+            bridgeNMEAGSVMessage((NMEAGSVMessage *)message);
+            break;
+
         case NMEA_MSG_TYPE_TXT:
         case NMEA_MSG_TYPE_VDM:
         case NMEA_MSG_TYPE_VDO:
             // Currently not output to clients.
-            logger << logDebugNMEADataModelBridge << "Ignoring " << message->source() << " "
-                   << nmeaMsgTypeName(msgType) << " message in NMEA->Data Model Bridge" << eol;
+            LOG(logDebugNMEADataModelBridge) << "Ignoring " << message->source() << " "
+                                             << nmeaMsgTypeName(msgType)
+                                             << " message in NMEA->Data Model Bridge" << eol;
             break;
 
         default:
-            logger << logWarning << "Unhandled " << message->source() << " "
-                   << nmeaMsgTypeName(msgType) << " message in NMEA->Data Model Bridge" << eol;
+            if (findNMEASentenceSchema(msgType) != NULL) {
+                bridgeNMEASchemaMessage((NMEASchemaMessage *)message);
+            } else {
+                LOG(logWarning) << "Unhandled " << message->source() << " "
+                                << nmeaMsgTypeName(msgType) << " message in NMEA->Data Model Bridge"
+                                << eol;
+            }
     }
 }
 
-void NMEADataModelBridge::bridgeNMEADBKMessage(NMEADBKMessage *message) {
-    message->depthFeet.publish(depthBelowKeelFeet);
-    message->depthMeters.publish(depthBelowKeelMeters);
-    message->depthFathoms.publish(depthBelowKeelFathoms);
-
-    messagesBridgedCounter++;
-}
-
-void NMEADataModelBridge::bridgeNMEADBSMessage(NMEADBSMessage *message) {
-    message->depthFeet.publish(depthBelowSurfaceFeet);
-    message->depthMeters.publish(depthBelowSurfaceMeters);
-    message->depthFathoms.publish(depthBelowSurfaceFathoms);
-
-    messagesBridgedCounter++;
-}
-
-void NMEADataModelBridge::bridgeNMEADBTMessage(NMEADBTMessage *message) {
-    message->depthFeet.publish(depthBelowTransducerFeet);
-    message->depthMeters.publish(depthBelowTransducerMeters);
-    message->depthFathoms.publish(depthBelowTransducerFathoms);
+// Sentences described by a schema carry the Data Model leaves for their fields with them.
+void NMEADataModelBridge::bridgeNMEASchemaMessage(NMEASchemaMessage *message) {
+    message->publish();
 
     messagesBridgedCounter++;
 }
 
 void NMEADataModelBridge::bridgeNMEAGGAMessage(NMEAGGAMessage *message) {
-    message->time.publish(gpsTime);
-    message->latitude.publish(gpsLatitude);
-    message->longitude.publish(gpsLongitude);
+    const bool staging = stageEpochSentence(message->time, EPOCH_SENTENCE_GGA);
+    if (staging) {
+        epochLatitude = message->latitude;
+        epochLongitude = message->longitude;
+    }
     message->gpsQuality.publish(gpsGPSQuality);
     message->numberSatellites.publish(gpsNumberSatellites);
     message->horizontalDilutionOfPrecision.publish(gpsHorizontalDilutionOfPrecision);
@@ -141,22 +279,33 @@ void NMEADataModelBridge::bridgeNMEAGGAMessage(NMEAGGAMessage *message) {
     message->gpsDataAge.publish(gpsDataAge);
     message->differentialReferenceStation.publish(gpsDifferentialReferenceStation);
 
+    if (staging) {
+        completeEpochSentence();
+    }
+
     messagesBridgedCounter++;
 }
 
 void NMEADataModelBridge::bridgeNMEAGLLMessage(NMEAGLLMessage *message) {
-    message->latitude.publish(gpsLatitude);
-    message->longitude.publish(gpsLongitude);
-    message->time.publish(gpsTime);
-    message->dataValid.publish(gpsDataValid);
-    message->faaModeIndicator.publish(gpsFAAModeindicator);
+    if (stageEpochSentence(message->time, EPOCH_SENTENCE_GLL)) {
+        epochLatitude = message->latitude;
+        epochLongitude = message->longitude;
+        epochDataValid = message->dataValid;
+        epochHasDataValid = true;
+        if (message->faaModeIndicator.hasValue()) {
+            epochFAAModeIndicator = message->faaModeIndicator;
+        }
+        completeEpochSentence();
+    }
 
     messagesBridgedCounter++;
 }
 
 // The Vesper GPS receivers, and possibly others, emit back to back GSA messages with two sets of
-// satellite IDs. This should be somehow detected so that the two groups can be concatenated
-// together.
+// satellite IDs. GSA carries no time, so like VTG it joins the epoch being staged, with its
+// satellites merged into the epoch's set. GSAs that arrive once the epoch has been committed, or
+// without any epochs, are merged and published together when the next epoch starts or after the
+// epoch timeout passes without another one.
 void NMEADataModelBridge::bridgeNMEAGSAMessage(NMEAGSAMessage *message) {
     if (message->automaticMode) {
         gpsSatelliteSelectionMode = "Automatic";
@@ -165,21 +314,24 @@ void NMEADataModelBridge::bridgeNMEAGSAMessage(NMEAGSAMessage *message) {
     }
     message->gpsFixMode.publish(gpsFixMode);
 
-    etl::string<activeSatellitesLength> activeSatellitesStr;
-    etl::string_stream activeSatellitesStrStream(activeSatellitesStr);
-    bool firstInList = true;
+    if (epochState == EPOCH_IDLE && !lateActiveSatellites) {
+        epochActiveSatellites.clear();
+    }
     for (unsigned satelliteIndex = 0; satelliteIndex < 12; satelliteIndex++) {
         if (message->satelliteIDs[satelliteIndex].hasValue()) {
-            if (!firstInList) {
-                activeSatellitesStrStream << ",";
-            } else {
-                firstInList = false;
+            const uint16_t prn = message->satelliteIDs[satelliteIndex].getValue();
+            if (!epochActiveSatellites.add(prn)) {
+                LOG(logDebugNMEADataModelBridge) << "Ignoring " << message->source()
+                                                 << " GSA satellite with unknown PRN " << prn
+                                                 << eol;
             }
-            activeSatellitesStrStream << message->satelliteIDs[satelliteIndex].getValue();
         }
     }
-
-    gpsActiveSatellites = activeSatellitesStr;
+    epochHasActiveSatellites = true;
+    if (epochState != EPOCH_STAGING) {
+        lateActiveSatellites = true;
+        epochTimer.setMilliSeconds(epochTimeoutMs);
+    }
 
     message->pdop.publish(gpsPDOP);
     message->hdop.publish(gpsHDOP);
@@ -187,38 +339,116 @@ void NMEADataModelBridge::bridgeNMEAGSAMessage(NMEAGSAMessage *message) {
 
     messagesBridgedCounter++;
 }
-void NMEADataModelBridge::bridgeNMEAGSTMessage(NMEAGSTMessage *message) {
-    message->standardDeviationOfRangeInputsRMS.publish(gpsStandardDeviationOfRangeInputsRMS);
-    message->standardDeviationOfSemiMajorAxis.publish(gpsStandardDeviationOfSemiMajorAxis);
-    message->standardDeviationOfSemiMinorAxis.publish(gpsStandardDeviationOfSemiMinorAxis);
-    message->orientationOfSemiMajorAxis.publish(gpsOrientationOfSemiMajorAxis);
-    message->standardDeviationOfLatitudeError.publish(gpsStandardDeviationOfLatitudeError);
-    message->standardDeviationOfLongitudeError.publish(gpsStandardDeviationOfLongitudeError);
-    message->standardDeviationOfAltitudeError.publish(gpsStandardDeviationOfAltitudeError);
+
+GSVSatelliteTable *NMEADataModelBridge::satelliteTable(const NMEATalker &talker) {
+    switch (talker.code()) {
+        case nmeaTalkerCode('G', 'P'):
+            return &gpsSatellites;
+
+        case nmeaTalkerCode('G', 'L'):
+            return &glonassSatellites;
+
+        case nmeaTalkerCode('G', 'A'):
+            return &galileoSatellites;
+
+        case nmeaTalkerCode('G', 'B'):
+        case nmeaTalkerCode('B', 'D'):
+            return &beiDouSatellites;
+
+        default:
+            return NULL;
+    }
+}
+
+// Satellites without a usable PRN are skipped, and ones missing other values are kept with those
+// values unavailable.
+void NMEADataModelBridge::bridgeNMEAGSVMessage(NMEAGSVMessage *message) {
+    GSVSatelliteTable *table = satelliteTable(message->source());
+    if (table == NULL) {
+        LOG(logDebugNMEADataModelBridge) << "Ignoring " << message->source()
+                                         << " GSV message in NMEA->Data Model Bridge" << eol;
+        return;
+    }
+
+    if (!message->sentencesInGroup.hasValue() || !message->sentenceNumber.hasValue() ||
+        !message->numberSatellites.hasValue()) {
+        return;
+    }
+
+    if (!table->startSentence(message->sentencesInGroup.getValue(),
+                              message->sentenceNumber.getValue(),
+                              message->numberSatellites.getValue())) {
+        return;
+    }
+
+    for (uint8_t satelliteIndex = 0; satelliteIndex < message->satelittesInMessage;
+         satelliteIndex++) {
+        const NMEAGSVSatelitteInfo &satellite = message->satelittes[satelliteIndex];
+        if (!satellite.id.hasValue() || satellite.id.getValue() == 0) {
+            continue;
+        }
+
+        const int8_t elevation = satellite.elevation.hasValue()
+                                 ? satellite.elevation.getValue()
+                                 : GSVSatellite::elevationNotAvailable;
+        const uint16_t azimuth = satellite.azimuth.hasValue() ? satellite.azimuth.getValue()
+                                                              : GSVSatellite::azimuthNotAvailable;
+        const uint8_t signalToNoiseRatio = satellite.signalToNoiseRatio.hasValue()
+                                           ? satellite.signalToNoiseRatio.getValue()
+                                           : GSVSatellite::signalToNoiseRatioNotAvailable;
+        table->updateSatellite(satellite.id.getValue(), elevation, azimuth, signalToNoiseRatio);
+    }
+
+    table->endSentence();
 
     messagesBridgedCounter++;
 }
 
 void NMEADataModelBridge::bridgeNMEARMCMessage(NMEARMCMessage *message) {
-    message->time.publish(gpsTime);
-    message->dataValid.publish(gpsDataValid);
-    message->latitude.publish(gpsLatitude);
-    message->longitude.publish(gpsLongitude);
-    message->speedOverGround.publish(gpsSpeedOverGround);
-    message->trackMadeGood.publish(gpsTrackMadeGoodTrue);
+    const bool staging = stageEpochSentence(message->time, EPOCH_SENTENCE_RMC);
+    if (staging) {
+        epochDataValid = message->dataValid;
+        epochHasDataValid = true;
+        epochLatitude = message->latitude;
+        epochLongitude = message->longitude;
+        epochHasDate = message->date.daysSinceEpoch(epochDays);
+        epochSpeedOverGround.stage(message->speedOverGround);
+        epochTrackMadeGoodTrue.stage(message->trackMadeGood);
+    }
     message->date.publish(gpsDate);
     message->magneticVariation.publish(gpsMagneticVariation);
-    message->faaModeIndicator.publish(gpsFAAModeindicator);
+
+    if (staging) {
+        if (message->faaModeIndicator.hasValue()) {
+            epochFAAModeIndicator = message->faaModeIndicator;
+        }
+        completeEpochSentence();
+    }
 
     messagesBridgedCounter++;
 }
 
+// VTG carries no time, so it joins whatever epoch is being staged. Once an epoch has been committed
+// its speed and track are only published if the epoch didn't already carry them from an RMC.
 void NMEADataModelBridge::bridgeNMEAVTGMessage(NMEAVTGMessage *message) {
-    message->trackMadeGoodTrue.publish(gpsTrackMadeGoodTrue);
     message->trackMadeGoodMagnetic.publish(gpsTrackMadeGoodMagnetic);
-    message->speedOverGround.publish(gpsSpeedOverGround);
     message->speedOverGroundKmPerH.publish(gpsSpeedOverGroundKmPerH);
-    message->faaModeIndicator.publish(gpsFAAModeindicator);
+
+    if (epochState == EPOCH_STAGING) {
+        epochSpeedOverGround.stage(message->speedOverGround);
+        epochTrackMadeGoodTrue.stage(message->trackMadeGoodTrue);
+        if (message->faaModeIndicator.hasValue()) {
+            epochFAAModeIndicator = message->faaModeIndicator;
+        }
+    } else {
+        if (!epochSpeedOverGround.isStaged()) {
+            message->speedOverGround.publish(gpsSpeedOverGround);
+        }
+        if (!epochTrackMadeGoodTrue.isStaged()) {
+            message->trackMadeGoodTrue.publish(gpsTrackMadeGoodTrue);
+        }
+        message->faaModeIndicator.publish(gpsFAAModeindicator);
+    }
 
     messagesBridgedCounter++;
 }
@@ -226,4 +456,8 @@ void NMEADataModelBridge::bridgeNMEAVTGMessage(NMEAVTGMessage *message) {
 void NMEADataModelBridge::exportStats(uint32_t msElapsed) {
     messagesBridgedCounter.update(sysNMEADataModelMessagesBridged,
                                   sysNMEADataModelMessageBridgeRate, msElapsed);
+    sysNMEADataModelEpochs << epochsCommitted;
+    sysNMEADataModelEpochTimeouts << epochTimeouts;
+    sysNMEADataModelSatellitesDropped << gpsSatellites.dropped() + glonassSatellites.dropped() +
+                                         galileoSatellites.dropped() + beiDouSatellites.dropped();
 }
@@ -19,40 +19,131 @@
 #ifndef NMEA_DATA_MODEL_BRIDGE_H
 #define NMEA_DATA_MODEL_BRIDGE_H
 
-class NMEADBKMessage;
-class NMEADBSMessage;
-class NMEADBTMessage;
+class NMEASchemaMessage;
 class NMEAGGAMessage;
 class NMEAGLLMessage;
 class NMEAGSAMessage;
-class NMEAGSTMessage;
+class NMEAGSVMessage;
 class NMEARMCMessage;
 class NMEAVTGMessage;
 class StatsMaanger;
 
+#include "GSVSatelliteTable.h"
+#include "SatellitePRNSet.h"
+
 #include "NMEA/NMEAMessageHandler.h"
-#
+#include "NMEA/NMEATalker.h"
+#include "NMEA/NMEATime.h"
+#include "NMEA/NMEALatitude.h"
+#include "NMEA/NMEALongitude.h"
+#include "NMEA/NMEADataValid.h"
+#include "NMEA/NMEAFAAModeIndicator.h"
+#include "NMEA/NMEAFixedPoint.h"
+
+#include "DataModel/DataModelTenthsUInt16Leaf.h"
+
 #include "StatsManager/StatCounter.h"
 #include "StatsManager/StatsHolder.h"
 
+#include "Util/PassiveTimer.h"
+#include "Util/UTCTimestamp.h"
+
 #include <stdint.h>
 
 class NMEADataModelBridge : public NMEAMessageHandler, public StatsHolder {
     private:
+        // A GPS fix cycle emits GGA, GLL and RMC sentences that all carry the same UTC time and
+        // repeat the time, position and status. Rather than publish those values from each
+        // sentence, they are staged per fix epoch, keyed on the time field, and committed once.
+        // An epoch is committed when the set of sentences seen in the previous epoch has arrived
+        // again, when a sentence with a new time shows up, or when the epoch timeout expires.
+        enum EpochSentence : uint8_t {
+            EPOCH_SENTENCE_GGA = 0x01,
+            EPOCH_SENTENCE_GLL = 0x02,
+            EPOCH_SENTENCE_RMC = 0x04
+        };
+
+        enum EpochState : uint8_t {
+            EPOCH_IDLE,
+            EPOCH_STAGING,
+            EPOCH_COMMITTED
+        };
+
+        // RMC and VTG both carry the speed over ground and true track. These are copied out of
+        // the sentences as they're staged, since the fields refer to the sentence's line. A value
+        // from a later sentence replaces an earlier one, but a missing value doesn't.
+        class EpochTenthsUInt16 {
+            private:
+                bool staged;
+                bool present;
+                uint16_t wholeNumber;
+                uint8_t tenths;
+
+            public:
+                EpochTenthsUInt16();
+                void clear();
+                void stage(const NMEATenthsUInt16 &field);
+                bool isStaged() const;
+                void publish(DataModelTenthsUInt16Leaf &leaf) const;
+        };
+
+        static const uint32_t defaultEpochTimeoutMs = 500;
+
         StatCounter messagesBridgedCounter;
+        EpochState epochState;
+        uint8_t epochSentences;
+        uint8_t expectedEpochSentences;
+        uint32_t epochTimeoutMs;
+        PassiveTimer epochTimer;
+        NMEATime epochTime;
+        NMEALatitude epochLatitude;
+        NMEALongitude epochLongitude;
+        bool epochHasDataValid;
+        NMEADataValid epochDataValid;
+        NMEAFAAModeIndicator epochFAAModeIndicator;
+        bool epochHasDate;
+        uint32_t epochDays;
+        EpochTenthsUInt16 epochSpeedOverGround;
+        EpochTenthsUInt16 epochTrackMadeGoodTrue;
+        // Some receivers split the active satellites over several GSA sentences, so the sets
+        // from an epoch are merged and published once with the epoch. GSAs that arrive after the
+        // epoch has been committed are held back until the next epoch starts or they stop coming.
+        bool epochHasActiveSatellites;
+        bool lateActiveSatellites;
+        SatellitePRNSet epochActiveSatellites;
+        SatellitePRNSet publishedActiveSatellites;
+        // The day of the last committed epoch, carried forward across midnight for epochs without
+        // an RMC date, and the last timestamp published from it.
+        bool hasTimestampDays;
+        uint32_t timestampDays;
+        uint32_t lastMilliSecondOfDay;
+        UTCTimestamp lastTimestamp;
+        uint32_t epochsCommitted;
+        uint32_t epochTimeouts;
+        GSVSatelliteTable gpsSatellites;
+        GSVSatelliteTable glonassSatellites;
+        GSVSatelliteTable galileoSatellites;
+        GSVSatelliteTable beiDouSatellites;
+
+        bool stageEpochSentence(const NMEATime &time, EpochSentence sentence);
+        void completeEpochSentence();
+        void commitEpoch();
+        void publishTimestamp();
+        void publishActiveSatellites();
 
-        void bridgeNMEADBKMessage(NMEADBKMessage *message);
-        void bridgeNMEADBSMessage(NMEADBSMessage *message);
-        void bridgeNMEADBTMessage(NMEADBTMessage *message);
+        void bridgeNMEASchemaMessage(NMEASchemaMessage *message);
         void bridgeNMEAGGAMessage(NMEAGGAMessage *message);
         void bridgeNMEAGLLMessage(NMEAGLLMessage *message);
         void bridgeNMEAGSAMessage(NMEAGSAMessage *message);
-        void bridgeNMEAGSTMessage(NMEAGSTMessage *message);
+        GSVSatelliteTable *satelliteTable(const NMEATalker &talker);
+        void bridgeNMEAGSVMessage(NMEAGSVMessage *message);
         void bridgeNMEARMCMessage(NMEARMCMessage *message);
         void bridgeNMEAVTGMessage(NMEAVTGMessage *message);
 
     public:
         NMEADataModelBridge(StatsManager &statsManager);
+        void setEpochTimeout(uint32_t milliSeconds);
+        void service();
         virtual void processMessage(NMEAMessage *message) override;
         virtual void exportStats(uint32_t msElapsed) override;
 };
@@ -0,0 +1,105 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SatellitePRNSet.h"
+
+#include <etl/string.h>
+#include <etl/to_string.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// The PRN ranges used in NMEA sentences, none of them more than 64 wide.
+const SatellitePRNSet::Constellation SatellitePRNSet::constellations[constellationCount] = {
+    { 1, 32 },      // GPS
+    { 33, 64 },     // SBAS
+    { 65, 96 },     // GLONASS
+    { 120, 158 },   // SBAS, numbered by PRN
+    { 193, 202 },   // QZSS
+    { 301, 336 },   // Galileo
+    { 401, 437 }    // BeiDou
+};
+
+SatellitePRNSet::SatellitePRNSet() {
+    clear();
+}
+
+void SatellitePRNSet::clear() {
+    for (size_t constellation = 0; constellation < constellationCount; constellation++) {
+        prns[constellation] = 0;
+    }
+}
+
+// Returns false if the PRN isn't in any known constellation's range.
+bool SatellitePRNSet::add(uint16_t prn) {
+    for (size_t constellation = 0; constellation < constellationCount; constellation++) {
+        const Constellation &range = constellations[constellation];
+        if (prn >= range.firstPRN && prn <= range.lastPRN) {
+            prns[constellation] |= (uint64_t)1 << (prn - range.firstPRN);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SatellitePRNSet::merge(const SatellitePRNSet &other) {
+    for (size_t constellation = 0; constellation < constellationCount; constellation++) {
+        prns[constellation] |= other.prns[constellation];
+    }
+}
+
+bool SatellitePRNSet::operator == (const SatellitePRNSet &other) const {
+    for (size_t constellation = 0; constellation < constellationCount; constellation++) {
+        if (prns[constellation] != other.prns[constellation]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SatellitePRNSet::operator != (const SatellitePRNSet &other) const {
+    return !(*this == other);
+}
+
+// Lists the PRNs in ascending order, comma separated. PRNs that won't fit in the string are left
+// off rather than being cut short.
+void SatellitePRNSet::format(etl::istring &prnsStr) const {
+    const size_t maxPRNLength = 4;
+
+    prnsStr.clear();
+    for (size_t constellation = 0; constellation < constellationCount; constellation++) {
+        uint64_t bits = prns[constellation];
+        for (uint16_t prn = constellations[constellation].firstPRN; bits; prn++, bits >>= 1) {
+            if (!(bits & 1)) {
+                continue;
+            }
+
+            if (prnsStr.size() + maxPRNLength > prnsStr.capacity()) {
+                return;
+            }
+            if (!prnsStr.empty()) {
+                prnsStr += ',';
+            }
+            etl::string<3> prnStr;
+            etl::to_string(prn, prnStr);
+            prnsStr += prnStr;
+        }
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SATELLITE_PRN_SET_H
+#define SATELLITE_PRN_SET_H
+
+#include <etl/string.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// A set of satellite PRNs, kept as a bitmap for each constellation's range of NMEA PRN numbers so
+// that sets from several sentences can be merged and compared without any searching.
+class SatellitePRNSet {
+    private:
+        struct Constellation {
+            uint16_t firstPRN;
+            uint16_t lastPRN;
+        };
+
+        static const size_t constellationCount = 7;
+        static const Constellation constellations[constellationCount];
+
+        uint64_t prns[constellationCount];
+
+    public:
+        SatellitePRNSet();
+        void clear();
+        bool add(uint16_t prn);
+        void merge(const SatellitePRNSet &other);
+        bool operator == (const SatellitePRNSet &other) const;
+        bool operator != (const SatellitePRNSet &other) const;
+        void format(etl::istring &prnsStr) const;
+};
+
+#endif
@@ -32,8 +32,12 @@
 
 NMEAWiFiSource::NMEAWiFiSource(WiFiManager &wifiManager, DataModelLeaf &messageCountDataModelLeaf,
                                DataModelLeaf &messageRateDataModelLeaf,
+                               DataModelLeaf &backlogDataModelLeaf,
+                               DataModelLeaf &budgetExhaustionsDataModelLeaf,
+                               DataModelLeaf &overlengthLinesDataModelLeaf,
                                DataModelBoolLeaf &connectionStatusLeaf, StatsManager &statsManager)
-    : NMEASource(client, messageCountDataModelLeaf, messageRateDataModelLeaf, statsManager),
+    : NMEASource(client, messageCountDataModelLeaf, messageRateDataModelLeaf, backlogDataModelLeaf,
+                 budgetExhaustionsDataModelLeaf, overlengthLinesDataModelLeaf, statsManager),
       wifiManager(wifiManager), clientConnected(false), connectionStatusLeaf(connectionStatusLeaf) {
     connectionStatusLeaf = false;
 }
@@ -46,8 +50,8 @@ void NMEAWiFiSource::service() {
     if (!clientConnected) {
         if (wifiManager.connected()) {
             if (client.connected()) {
-                logger << logNotify << "Connected NMEA WiFi Client " << nmeaWiFiSourceIPAddress
-                       << ":" << nmeaWiFiSourceTCPPort << eol;
+                LOG(logNotify) << "Connected NMEA WiFi Client " << nmeaWiFiSourceIPAddress
+                               << ":" << nmeaWiFiSourceTCPPort << eol;
                 clientConnected = true;
                 connectionStatusLeaf = true;
             }
@@ -59,8 +63,8 @@ void NMEAWiFiSource::service() {
         if (!client.connected()) {
             clientConnected = false;
             connectionStatusLeaf = false;
-            logger << logNotify << "NMEA WiFi Client " << nmeaWiFiSourceIPAddress << ":"
-                   << nmeaWiFiSourceTCPPort << " disconnected. Retrying..." << eol;
+            LOG(logNotify) << "NMEA WiFi Client " << nmeaWiFiSourceIPAddress << ":"
+                           << nmeaWiFiSourceTCPPort << " disconnected. Retrying..." << eol;
             connect();
         }
 
@@ -84,8 +88,8 @@ void NMEAWiFiSource::connect() {
         clientConnected = true;
         connectionStatusLeaf = true;
 
-        logger << logNotify << "Connected NMEA WiFi Client " << nmeaWiFiSourceIPAddress << ":"
-               << nmeaWiFiSourceTCPPort << eol;
+        LOG(logNotify) << "Connected NMEA WiFi Client " << nmeaWiFiSourceIPAddress << ":"
+                       << nmeaWiFiSourceTCPPort << eol;
     } else {
         // It's believed that the WiFiNINA library will initiate a connection, wait for a bit to
         // see if it connects (comments say 4 sec, code does 10), and return either a success or
@@ -98,7 +102,7 @@ void NMEAWiFiSource::connect() {
 }
 
 void NMEAWiFiSource::wifiDisconnected() {
-    logger << logNotify << "Lost WiFi, disconnecting NMEA WiFi Client" << eol;
+    LOG(logNotify) << "Lost WiFi, disconnecting NMEA WiFi Client" << eol;
     client.stop();
 }
 
@@ -41,7 +41,9 @@ class NMEAWiFiSource : public NMEASource, public WiFiManagerClient {
 
     public:
         NMEAWiFiSource(WiFiManager &wifiManager, DataModelLeaf &messageCountDataModelLeaf,
-                       DataModelLeaf &messageRateDataModelLeaf,
+                       DataModelLeaf &messageRateDataModelLeaf, DataModelLeaf &backlogDataModelLeaf,
+                       DataModelLeaf &budgetExhaustionsDataModelLeaf,
+                       DataModelLeaf &overlengthLinesDataModelLeaf,
                        DataModelBoolLeaf &connectionStatusLeaf, StatsManager &statsManager);
         void begin();
         void service();
@@ -0,0 +1,169 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoopProfiler.h"
+
+#if LOOP_PROFILING
+
+#include "StatsManager.h"
+
+#include "DataModel/DataModel.h"
+#include "DataModel/DataModelNode.h"
+#include "DataModel/DataModelUInt32Leaf.h"
+#include "DataModel/DataModelStringLeaf.h"
+
+#include <etl/string.h>
+#include <etl/to_string.h>
+
+#include <Arduino.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+static const char *loopStageNames[LOOP_STAGE_COUNT] = {
+    "wifiManager",
+    "usbNMEASource",
+    "wifiNMEASource",
+    "nmeaDataModelBridge",
+    "aisTargetTable",
+    "mqttBroker",
+    "statsManager",
+    "logger"
+};
+
+LoopStageProfile::LoopStageProfile()
+    : node(NULL, NULL, children),
+      minLeaf("min", &node),
+      averageLeaf("avg", &node),
+      maxLeaf("max", &node),
+      histogramLeaf("histogram", &node, histogramBuffer) {
+    children[0] = &minLeaf;
+    children[1] = &averageLeaf;
+    children[2] = &maxLeaf;
+    children[3] = &histogramLeaf;
+    children[leafCount] = NULL;
+
+    clearInterval();
+}
+
+DataModelElement *LoopStageProfile::dataModelNode(const char *name, DataModelElement *parent) {
+    node.setName(name);
+    node.setParent(parent);
+    return &node;
+}
+
+void LoopStageProfile::clearInterval() {
+    runs = 0;
+    totalMicroseconds = 0;
+    minMicroseconds = 0xffffffff;
+    maxMicroseconds = 0;
+    for (size_t bucket = 0; bucket < loopHistogramBuckets; bucket++) {
+        histogram[bucket] = 0;
+    }
+}
+
+void LoopStageProfile::record(uint32_t microseconds) {
+    runs++;
+    totalMicroseconds += microseconds;
+    if (microseconds < minMicroseconds) {
+        minMicroseconds = microseconds;
+    }
+    if (microseconds > maxMicroseconds) {
+        maxMicroseconds = microseconds;
+    }
+
+    size_t bucket = 0;
+    while (bucket < loopHistogramBuckets - 1 && microseconds >= (1UL << bucket)) {
+        bucket++;
+    }
+    histogram[bucket]++;
+}
+
+void LoopStageProfile::exportStats() {
+    if (runs) {
+        minLeaf = minMicroseconds;
+        averageLeaf = totalMicroseconds / runs;
+    } else {
+        minLeaf = 0;
+        averageLeaf = 0;
+    }
+    maxLeaf = maxMicroseconds;
+
+    size_t lastBucketInUse = 0;
+    for (size_t bucket = 0; bucket < loopHistogramBuckets; bucket++) {
+        if (histogram[bucket]) {
+            lastBucketInUse = bucket;
+        }
+    }
+    etl::string<maxHistogramLength> histogramStr;
+    for (size_t bucket = 0; bucket <= lastBucketInUse; bucket++) {
+        if (bucket) {
+            histogramStr += ' ';
+        }
+        etl::string<10> countStr;
+        etl::to_string(histogram[bucket], countStr);
+        histogramStr += countStr;
+    }
+    histogramLeaf = histogramStr;
+
+    clearInterval();
+}
+
+// The stages' nodes are followed in $SYS/loop by the whole loop and the worst case leaf.
+LoopProfiler::LoopProfiler(StatsManager &statsManager)
+    : worstLeaf("worst", &sysLoopNode), worstMicroseconds(0), loopStartMicroseconds(0),
+      stageStartMicroseconds(0) {
+    for (uint8_t stage = 0; stage < LOOP_STAGE_COUNT; stage++) {
+        sysLoopNodeChildren[stage] = stages[stage].dataModelNode(loopStageNames[stage],
+                                                                 &sysLoopNode);
+    }
+    sysLoopNodeChildren[LOOP_STAGE_COUNT] = loopTotal.dataModelNode("total", &sysLoopNode);
+    sysLoopNodeChildren[LOOP_STAGE_COUNT + 1] = &worstLeaf;
+    sysLoopNodeChildren[LOOP_STAGE_COUNT + 2] = NULL;
+
+    statsManager.addStatsHolder(this);
+}
+
+void LoopProfiler::startLoop() {
+    loopStartMicroseconds = micros();
+    stageStartMicroseconds = loopStartMicroseconds;
+}
+
+void LoopProfiler::endStage(LoopStage stage) {
+    const uint32_t now = micros();
+    stages[stage].record(now - stageStartMicroseconds);
+    stageStartMicroseconds = now;
+}
+
+void LoopProfiler::endLoop() {
+    const uint32_t loopMicroseconds = stageStartMicroseconds - loopStartMicroseconds;
+    loopTotal.record(loopMicroseconds);
+    if (loopMicroseconds > worstMicroseconds) {
+        worstMicroseconds = loopMicroseconds;
+    }
+}
+
+void LoopProfiler::exportStats(__attribute__((unused)) uint32_t msElapsed) {
+    for (uint8_t stage = 0; stage < LOOP_STAGE_COUNT; stage++) {
+        stages[stage].exportStats();
+    }
+    loopTotal.exportStats();
+    worstLeaf = worstMicroseconds;
+}
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOOP_PROFILER_H
+#define LOOP_PROFILER_H
+
+#include "LoopStage.h"
+
+#if LOOP_PROFILING
+
+class StatsManager;
+
+#include "StatsManager/StatsHolder.h"
+
+#include "DataModel/DataModelNode.h"
+#include "DataModel/DataModelUInt32Leaf.h"
+#include "DataModel/DataModelStringLeaf.h"
+
+#include <etl/string.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Bucket 0 counts runs that took under a microsecond and bucket n those that took from 2^(n-1) up
+// to 2^n microseconds, with the last bucket taking everything longer.
+const size_t loopHistogramBuckets = 16;
+
+// Timing of one stage, or of the whole loop, over a stats interval. Each has a node of its own
+// under $SYS/loop with the minimum, average and maximum times in microseconds and a histogram of
+// the counts in each bucket, separated by spaces and ending with the last bucket in use.
+class LoopStageProfile {
+    private:
+        static const size_t leafCount = loopStageProfileLeaves;
+        static const size_t maxHistogramLength = loopHistogramBuckets * 11;
+
+        DataModelElement *children[leafCount + 1];
+        DataModelNode node;
+        DataModelUInt32Leaf minLeaf;
+        DataModelUInt32Leaf averageLeaf;
+        DataModelUInt32Leaf maxLeaf;
+        etl::string<maxHistogramLength> histogramBuffer;
+        DataModelStringLeaf histogramLeaf;
+
+        uint32_t runs;
+        uint32_t totalMicroseconds;
+        uint32_t minMicroseconds;
+        uint32_t maxMicroseconds;
+        uint32_t histogram[loopHistogramBuckets];
+
+        void clearInterval();
+
+    public:
+        LoopStageProfile();
+        DataModelElement *dataModelNode(const char *name, DataModelElement *parent);
+        void record(uint32_t microseconds);
+        void exportStats();
+};
+
+// Times each stage of loop() with micros(). The loop marks its start and the end of each stage,
+// using the macros below so that the calls disappear along with the profiler when it's compiled
+// out:
+//     LOOP_PROFILE_START(loopProfiler);
+//     wifiManager.service();
+//     LOOP_PROFILE_STAGE(loopProfiler, LOOP_STAGE_WIFI_MANAGER);
+//     ...
+//     LOOP_PROFILE_END(loopProfiler);
+// The stages' timing is exported as $SYS/loop/<stage>/..., with the whole loop as
+// $SYS/loop/total/... and the longest loop seen since start up as $SYS/loop/worst.
+class LoopProfiler : public StatsHolder {
+    private:
+        LoopStageProfile stages[LOOP_STAGE_COUNT];
+        LoopStageProfile loopTotal;
+        DataModelUInt32Leaf worstLeaf;
+        uint32_t worstMicroseconds;
+        uint32_t loopStartMicroseconds;
+        uint32_t stageStartMicroseconds;
+
+    public:
+        LoopProfiler(StatsManager &statsManager);
+        void startLoop();
+        void endStage(LoopStage stage);
+        void endLoop();
+        virtual void exportStats(uint32_t msElapsed) override;
+};
+
+#define LOOP_PROFILE_START(profiler) (profiler).startLoop()
+#define LOOP_PROFILE_STAGE(profiler, stage) (profiler).endStage(stage)
+#define LOOP_PROFILE_END(profiler) (profiler).endLoop()
+
+#else
+
+#define LOOP_PROFILE_START(profiler)
+#define LOOP_PROFILE_STAGE(profiler, stage)
+#define LOOP_PROFILE_END(profiler)
+
+#endif
+
+#endif
@@ -0,0 +1,41 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOOP_STAGE_H
+#define LOOP_STAGE_H
+
+// Timing of each stage of loop() is compiled in by default. Builds that don't want the cost of the
+// calls to micros() can remove the profiler, along with its $SYS/loop branch of the Data Model,
+// with -D LOOP_PROFILING=0.
+#ifndef LOOP_PROFILING
+#define LOOP_PROFILING 1
+#endif
+
+enum LoopStage {
+    LOOP_STAGE_WIFI_MANAGER,
+    LOOP_STAGE_USB_NMEA_SOURCE,
+    LOOP_STAGE_WIFI_NMEA_SOURCE,
+    LOOP_STAGE_NMEA_DATA_MODEL_BRIDGE,
+    LOOP_STAGE_AIS_TARGET_TABLE,
+    LOOP_STAGE_MQTT_BROKER,
+    LOOP_STAGE_STATS_MANAGER,
+    LOOP_STAGE_LOGGER,
+    LOOP_STAGE_COUNT
+};
+
+#endif
@@ -48,8 +48,8 @@ void StatCounter::update(DataModelLeaf &countLeaf, DataModelLeaf &rateLeaf, uint
     const uint32_t eventsPerSecond = (countInInterval * msInSecond) / msElapsed;
     rateLeaf << eventsPerSecond;
 
-    logger << logDebugStatsManager << "Harvested counter: " << count << " " << eventsPerSecond
-           << "/sec" << eol;
+    LOG(logDebugStatsManager) << "Harvested counter: " << count << " " << eventsPerSecond
+                              << "/sec" << eol;
 
     lastIntervalCount = count;
 }
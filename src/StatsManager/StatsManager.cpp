@@ -58,8 +58,8 @@ void StatsManager::service() {
         const uint32_t elapsedTime = lastHarvestTime.elapsedTime();
         lastHarvestTime.setNow();
 
-        logger << logDebugStatsManager << "Harvesting stats with elapsed time " << elapsedTime
-               << "ms" << eol;
+        LOG(logDebugStatsManager) << "Harvesting stats with elapsed time " << elapsedTime
+                                  << "ms" << eol;
 
         for (StatsHolder *statsHolder : statsHolders) {
             statsHolder->exportStats(elapsedTime);
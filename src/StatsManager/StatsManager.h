@@ -31,7 +31,7 @@ class StatsManager {
         const uint32_t statsUpdateTimeInterval = 10;
         PassiveTimer statsUpdateTimer;
         PassiveTimer lastHarvestTime;
-        etl::vector<StatsHolder *, 10> statsHolders;
+        etl::vector<StatsHolder *, 12> statsHolders;
 
     public:
         StatsManager();
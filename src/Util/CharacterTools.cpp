@@ -19,12 +19,40 @@
 #include "CharacterTools.h"
 
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 #include <Arduino.h>
 
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "fourDecimalDigitsValue assumes a little endian processor"
+#endif
+
 uint8_t decimalValue(char character) {
     return character - '0';
 }
 
+// Converts four decimal digits at once, treating them as the bytes of a 32 bit word, first digit in
+// the least significant byte. Returns false, without setting the value, if any of the characters
+// isn't a digit.
+bool fourDecimalDigitsValue(const char *characters, uint16_t &value) {
+    uint32_t word;
+    memcpy(&word, characters, sizeof(word));
+
+    // Digits are 0x30-0x39, so each byte must have a high nibble of 3 both before and after adding
+    // 6 to it.
+    if ((word & 0xf0f0f0f0) != 0x30303030 || ((word + 0x06060606) & 0xf0f0f0f0) != 0x30303030) {
+        return false;
+    }
+
+    // Combine neighbouring digits into pairs, then the pairs into the whole value.
+    word &= 0x0f0f0f0f;
+    word = (word * 10 + (word >> 8)) & 0x00ff00ff;
+    word = (word * 100 + (word >> 16)) & 0x0000ffff;
+
+    value = word;
+    return true;
+}
+
 bool isUpperCaseHexidecimalDigit(char character) {
     return isDigit(character) || (isUpperCase(character) && isHexadecimalDigit(character));
 }
@@ -41,6 +69,12 @@ uint8_t hexidecimalValue(char character) {
     }
 }
 
+char upperCaseHexidecimalDigit(uint8_t value) {
+    static const char hexidecimalDigits[] = "0123456789ABCDEF";
+
+    return hexidecimalDigits[value & 0xf];
+}
+
 bool isCarriageReturn(char character) {
     return character == '\r';
 }
@@ -48,3 +82,50 @@ bool isCarriageReturn(char character) {
 bool isLineFeed(char character) {
     return character == '\n';
 }
+
+// Returns a pointer to the first occurrence of the character in [start, end), or end if there isn't
+// one, XORing each byte before it into xorValue along the way. Once aligned, the search is done a
+// word at a time using the usual "has a zero byte" trick on the word XORed with the character
+// repeated in each byte, with the XOR also being done a word at a time and folded at the end.
+// This matters on the SAMD, where newlib's memchr is built for size and goes a byte at a time.
+const char *findCharacterWithXOR(const char *start, const char *end, char character,
+                                 uint8_t &xorValue) {
+    typedef uint32_t __attribute__((__may_alias__)) AliasedWord;
+    const char *pos = start;
+    uint8_t xorBytes = xorValue;
+
+    while (pos < end && ((uintptr_t)pos & (sizeof(uint32_t) - 1))) {
+        if (*pos == character) {
+            xorValue = xorBytes;
+            return pos;
+        }
+        xorBytes ^= *pos;
+        pos++;
+    }
+
+    const uint32_t pattern = (uint8_t)character * 0x01010101U;
+    uint32_t xorWords = 0;
+    while ((size_t)(end - pos) >= sizeof(uint32_t)) {
+        const uint32_t word = *(const AliasedWord *)pos;
+        const uint32_t matchWord = word ^ pattern;
+        if ((matchWord - 0x01010101U) & ~matchWord & 0x80808080U) {
+            break;
+        }
+        xorWords ^= word;
+        pos += sizeof(uint32_t);
+    }
+    xorWords ^= xorWords >> 16;
+    xorWords ^= xorWords >> 8;
+    xorBytes ^= (uint8_t)xorWords;
+
+    while (pos < end) {
+        if (*pos == character) {
+            break;
+        }
+        xorBytes ^= *pos;
+        pos++;
+    }
+
+    xorValue = xorBytes;
+    return pos;
+}
@@ -20,11 +20,16 @@
 #define CHARACTER_TOOLS_H
 
 #include <stdint.h>
+#include <stddef.h>
 
 extern uint8_t decimalValue(char character);
+extern bool fourDecimalDigitsValue(const char *characters, uint16_t &value);
 extern bool isUpperCaseHexidecimalDigit(char character);
 extern uint8_t hexidecimalValue(char character);
+extern char upperCaseHexidecimalDigit(uint8_t value);
 extern bool isCarriageReturn(char character);
 extern bool isLineFeed(char character);
+extern const char *findCharacterWithXOR(const char *start, const char *end, char character,
+                                        uint8_t &xorValue);
 
 #endif
@@ -17,17 +17,22 @@
  */
 
 #include "Error.h"
+#include "Logger.h"
 
 #include <etl/string.h>
 
 #include <Arduino.h>
 
+// Anything the logger still has buffered goes out first, so that the lines leading up to the error
+// aren't lost.
 void fatalError(const char *errorMsg) {
+    logger.flush();
     Serial.println(errorMsg);
     errorExit();
 }
 
 void fatalError(const etl::istring &errorMsg) {
+    logger.flush();
     Serial.println(errorMsg.data());
     errorExit();
 }
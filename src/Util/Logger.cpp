@@ -24,6 +24,7 @@
 
 #include <etl/string.h>
 #include <etl/string_view.h>
+#include <etl/to_string.h>
 
 #include <Arduino.h>
 
@@ -33,7 +34,9 @@ Logger logger(LOGGER_LEVEL_WARNING, Serial);
 
 Logger::Logger(LoggerLevel level, Stream &console)
     : logLevel(level), lineLevel(LOGGER_LEVEL_ERROR), outputCurrentLine(false), base(Dec),
-      console(console), errorsSetInDataModel(0), errorLinePos(0), inLogger(false) {
+      console(console), consoleBufferHead(0), consoleBufferTail(0), lineHead(0),
+      lineOverflowed(false), linesDropped(0), nextLogEntry(0),
+      logEntryNumber(0), errorLinePos(0), inLogger(false) {
     errorLine[0] = 0;
 
     unsigned moduleIndex;
@@ -56,17 +59,7 @@ void Logger::disableModuleDebug(LoggerModule module) {
 
 Logger & Logger::operator << (const LogSelector logSelector) {
     lineLevel = (LoggerLevel)((uint16_t)logSelector >> LOG_LEVEL_SHIFT);
-    if (lineLevel >= logLevel) {
-        if (lineLevel == LOGGER_LEVEL_DEBUG) {
-            const enum LoggerModule module =
-                (LoggerModule)((uint16_t)logSelector & LOGGER_MODULE_MASK);
-            outputCurrentLine = moduleDebugFlags[module];
-        } else {
-            outputCurrentLine = true;
-        }
-    } else {
-        outputCurrentLine = false;
-    }
+    outputCurrentLine = lineLevel >= LOGGER_MIN_LEVEL && enabled(logSelector);
 
     return *this;
 }
@@ -184,6 +177,7 @@ Logger & Logger::operator << (uint32_t value) {
     return *this;
 }
 
+#ifdef ARDUINO
 Logger & Logger::operator << (unsigned value) {
     if (outputCurrentLine) {
         switch (base) {
@@ -206,6 +200,7 @@ Logger & Logger::operator << (unsigned value) {
 
     return *this;
 }
+#endif
 
 Logger & Logger::operator << (int16_t value) {
     if (outputCurrentLine) {
@@ -300,7 +295,9 @@ Logger & Logger::operator << (const EndOfLine &eol) {
     base = Dec;
  
     if (outputCurrentLine) {
-        console.println();
+        queueCharacter('\r');
+        queueCharacter('\n');
+        endLine();
 
         if (lineLevel >= LOGGER_LEVEL_WARNING) {
             addErrorLineToDebugs();
@@ -315,8 +312,75 @@ Logger & Logger::operator << (const EndOfLine &eol) {
     return *this;
 }
 
+// Writes out as much of the buffered output as the console can take without blocking.
+void Logger::service() {
+    while (consoleBufferTail != consoleBufferHead) {
+        const int space = console.availableForWrite();
+        if (space <= 0 || writeConsoleBuffer(space) == 0) {
+            return;
+        }
+    }
+}
+
+// Writes out all of the buffered output, waiting on the console if need be. Used when stopping on
+// a fatal error.
+void Logger::flush() {
+    while (consoleBufferTail != consoleBufferHead) {
+        if (writeConsoleBuffer(consoleBufferSize) == 0) {
+            break;
+        }
+    }
+    console.flush();
+}
+
+// Writes up to maxLength characters from the contiguous run at the tail of the buffer, returning
+// how many were taken.
+size_t Logger::writeConsoleBuffer(size_t maxLength) {
+    const size_t runEnd =
+        consoleBufferHead > consoleBufferTail ? consoleBufferHead : consoleBufferSize;
+    size_t length = runEnd - consoleBufferTail;
+    if (length > maxLength) {
+        length = maxLength;
+    }
+
+    const size_t written = console.write((const uint8_t *)consoleBuffer + consoleBufferTail,
+                                         length);
+    consoleBufferTail = (consoleBufferTail + written) & consoleBufferMask;
+
+    return written;
+}
+
+// Characters go in after the end of the last complete line and only become part of the output when
+// endLine() is called.
+void Logger::queueCharacter(char character) {
+    if (lineOverflowed) {
+        return;
+    }
+
+    const uint16_t nextHead = (lineHead + 1) & consoleBufferMask;
+    if (nextHead == consoleBufferTail) {
+        lineOverflowed = true;
+        return;
+    }
+    consoleBuffer[lineHead] = character;
+    lineHead = nextHead;
+}
+
+// Hands the line to service() if all of it fit in the ring, otherwise throws away what there was.
+void Logger::endLine() {
+    if (lineOverflowed) {
+        lineHead = consoleBufferHead;
+        lineOverflowed = false;
+        linesDropped++;
+    } else {
+        consoleBufferHead = lineHead;
+    }
+}
+
 void Logger::logString(const char *string) {
-    console.print(string);
+    for (const char *character = string; *character; character++) {
+        queueCharacter(*character);
+    }
 
     if (lineLevel >= LOGGER_LEVEL_WARNING && !inLogger) {
         unsigned strPos;
@@ -330,37 +394,32 @@ void Logger::logString(const char *string) {
 }
 
 void Logger::logCharacter(char character) {
-    console.print(character);
+    queueCharacter(character);
 
-    if (lineLevel >= LOGGER_LEVEL_WARNING && !inLogger) {
+    if (lineLevel >= LOGGER_LEVEL_WARNING && !inLogger && errorLinePos < maxLogEntryLength - 1) {
         errorLine[errorLinePos] = character;
         errorLinePos++;
         errorLine[errorLinePos] = 0;
     }
 }
 
+void Logger::exportStats(__attribute__((unused)) uint32_t msElapsed) {
+    sysLogDroppedLines = linesDropped;
+}
+
 void Logger::addErrorLineToDebugs() {
     if (!inLogger) {
         inLogger = true;
 
-        if (errorsSetInDataModel == logEntrySlots) {
-            scrollUpDebugs();
-        }
+        logEntryNumber++;
+        etl::string<maxLogEntryLength> entry;
+        etl::to_string(logEntryNumber, entry);
+        entry += ": ";
+        entry += errorLine;
 
-        DataModelStringLeaf *errorDebug = sysLogEntries[errorsSetInDataModel];
-        *errorDebug = errorLine;
-        errorsSetInDataModel++;
+        *sysLogEntries[nextLogEntry] = entry;
+        nextLogEntry = (nextLogEntry + 1) % logEntrySlots;
 
         inLogger = false;
     }
 }
-
-void Logger::scrollUpDebugs() {
-    unsigned slot;
-    for (slot = 0; slot < logEntrySlots - 1; slot++) {
-        DataModelStringLeaf *toErrorDebug = sysLogEntries[slot];
-        DataModelStringLeaf *fromErrorDebug = sysLogEntries[slot + 1];
-        *toErrorDebug = *fromErrorDebug;
-    }
-    errorsSetInDataModel--;
-}
@@ -25,6 +25,8 @@
 
 #include "MQTT/MQTTString.h"
 
+#include "StatsManager/StatsHolder.h"
+
 #include <etl/string.h>
 #include <etl/string_view.h>
 
@@ -33,6 +35,7 @@
 #include <stdint.h>
 
 enum LoggerModule {
+    LOGGER_MODULE_AIS,
     LOGGER_MODULE_DATA_MODEL,
     LOGGER_MODULE_MQTT,
     LOGGER_MODULE_NMEA,
@@ -57,6 +60,7 @@ enum LoggerLevel {
 
 #define LOG_SELECTOR(level, module) (((level) << LOG_LEVEL_SHIFT) | (module))
 enum LogSelector {
+    logDebugAIS = LOG_SELECTOR(LOGGER_LEVEL_DEBUG, LOGGER_MODULE_AIS),
     logDebugDataModel = LOG_SELECTOR(LOGGER_LEVEL_DEBUG, LOGGER_MODULE_DATA_MODEL),
     logDebugMQTT = LOG_SELECTOR(LOGGER_LEVEL_DEBUG, LOGGER_MODULE_MQTT),
     logDebugNMEA = LOG_SELECTOR(LOGGER_LEVEL_DEBUG, LOGGER_MODULE_NMEA),
@@ -76,19 +80,57 @@ enum LogBase {
     Hex
 };
 
+// Lines below this level are compiled out of the program, along with the work of building them.
+// Release builds can raise it with, for example, -D LOGGER_MIN_LEVEL=LOGGER_LEVEL_WARNING.
+#ifndef LOGGER_MIN_LEVEL
+#define LOGGER_MIN_LEVEL LOGGER_LEVEL_DEBUG
+#endif
+
+// True if a line with the given selector would be output. The compile time level is checked first
+// so that, for constant selectors, disabled lines fold away entirely.
+#define LOG_ENABLED(selector) \
+    ((((selector) >> LOG_LEVEL_SHIFT) >= LOGGER_MIN_LEVEL) && logger.enabled(selector))
+
+// Starts a log line that is complete in a single statement, checking the level and module before
+// any of the line's values are evaluated:
+//     LOG(logDebugNMEA) << talker << " " << msgType << eol;
+// Lines built up over several statements need to start with logger << selector as before, with
+// the whole of the line guarded by LOG_ENABLED() if it's worth skipping.
+#define LOG(selector) \
+    if (!LOG_ENABLED(selector)) { \
+    } else logger << (selector)
+
 struct EndOfLine {};
 const EndOfLine eol = EndOfLine();
 
-class Logger {
+class Logger : public StatsHolder {
     private:
         LoggerLevel logLevel;
         LoggerLevel lineLevel;
         bool outputCurrentLine;
         bool moduleDebugFlags[LOGGER_MODULE_COUNT];
 
+        // Output is formatted into a ring and written to the console from service(), as much as
+        // it will take without blocking. A line only joins the output at its end of line, so if the
+        // ring fills while it's being formatted the whole line is dropped, and counted in
+        // $SYS/log/droppedLines, rather than leaving part of it spliced onto the next.
+        static const size_t consoleBufferSize = 1024;
+        static const size_t consoleBufferMask = consoleBufferSize - 1;
+        static_assert((consoleBufferSize & consoleBufferMask) == 0,
+                      "Logger console buffer size must be a power of two");
+
         LogBase base;
         Stream &console;
-        uint8_t errorsSetInDataModel;
+        char consoleBuffer[consoleBufferSize];
+        uint16_t consoleBufferHead;
+        uint16_t consoleBufferTail;
+        uint16_t lineHead;
+        bool lineOverflowed;
+        uint32_t linesDropped;
+        // The $SYS/log entries are used as a ring, so that each error only changes one of them.
+        // Entries are numbered so that subscribers can put them in order.
+        uint8_t nextLogEntry;
+        uint32_t logEntryNumber;
         char errorLine[maxLogEntryLength];
         unsigned errorLinePos;
         // Flag used to make sure that we don't try to set an error in the DataModel that occured
@@ -97,14 +139,20 @@ class Logger {
 
         void logString(const char *string);
         void logCharacter(char character);
+        void queueCharacter(char character);
+        void endLine();
+        size_t writeConsoleBuffer(size_t maxLength);
         void addErrorLineToDebugs();
-        void scrollUpDebugs();
 
     public:
         Logger(LoggerLevel level, Stream &console);
         void setLevel(LoggerLevel level);
         void enableModuleDebug(LoggerModule module);
         void disableModuleDebug(LoggerModule module);
+        bool enabled(LogSelector selector) const;
+        void service();
+        void flush();
+        virtual void exportStats(uint32_t msElapsed) override;
         Logger & operator << (const LogSelector level);
         Logger & operator << (const LogBase base);
         Logger & operator << (char character);
@@ -114,7 +162,10 @@ class Logger {
         Logger & operator << (uint8_t value);
         Logger & operator << (uint16_t value);
         Logger & operator << (uint32_t value);
+#ifdef ARDUINO
+        // On the SAMD uint32_t is an unsigned long, on host builds it's the same type as unsigned.
         Logger & operator << (unsigned value);
+#endif
         Logger & operator << (int16_t value);
         Logger & operator << (int value);
         Logger & operator << (bool value);
@@ -128,4 +179,18 @@ class Logger {
 
 extern Logger logger;
 
+// Inlined so that the check before each line costs no more than a compare or two.
+inline bool Logger::enabled(LogSelector selector) const {
+    const LoggerLevel level = (LoggerLevel)((uint16_t)selector >> LOG_LEVEL_SHIFT);
+    if (level < logLevel) {
+        return false;
+    }
+
+    if (level == LOGGER_LEVEL_DEBUG) {
+        return moduleDebugFlags[(uint16_t)selector & LOGGER_MODULE_MASK];
+    }
+
+    return true;
+}
+
 #endif
@@ -24,6 +24,21 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
+
+// Two decimal digits for each value from 0 to 99, so that formatting takes one division by 100
+// for every pair of digits rather than one by 10 for each digit.
+static const char digitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
 
 bool extractUInt32FromStringView(const etl::string_view &stringView, size_t start, size_t length,
                                  uint32_t &value, uint32_t maxValue) {
@@ -75,3 +90,40 @@ bool extractUInt8FromStringView(const etl::string_view &stringView, size_t start
     value = conversionResult.value();
     return true;
 }
+
+// Writes the value in decimal, NUL terminated, and returns a pointer to the terminator so that
+// more can be appended. The buffer needs room for 11 characters.
+char *formatUInt32(uint32_t value, char *buffer) {
+    char digits[10];
+    char *firstDigit = digits + sizeof(digits);
+
+    while (value >= 100) {
+        const char *pair = digitPairs + (value % 100) * 2;
+        value /= 100;
+        *--firstDigit = pair[1];
+        *--firstDigit = pair[0];
+    }
+    if (value >= 10) {
+        const char *pair = digitPairs + value * 2;
+        *--firstDigit = pair[1];
+        *--firstDigit = pair[0];
+    } else {
+        *--firstDigit = '0' + value;
+    }
+
+    size_t length = digits + sizeof(digits) - firstDigit;
+    memcpy(buffer, firstDigit, length);
+    buffer[length] = 0;
+
+    return buffer + length;
+}
+
+// As formatUInt32, with room needed for 12 characters.
+char *formatInt32(int32_t value, char *buffer) {
+    if (value < 0) {
+        *buffer++ = '-';
+        return formatUInt32(0 - (uint32_t)value, buffer);
+    } else {
+        return formatUInt32(value, buffer);
+    }
+}
@@ -31,5 +31,7 @@ extern bool extractUInt16FromStringView(const etl::string_view &stringView, size
                                         size_t length, uint16_t &value, uint16_t maxValue = 0xffff);
 extern bool extractUInt8FromStringView(const etl::string_view &stringView, size_t start,
                                        size_t length, uint8_t &value, uint8_t maxValue = 0xff);
+extern char *formatUInt32(uint32_t value, char *buffer);
+extern char *formatInt32(int32_t value, char *buffer);
 
 #endif
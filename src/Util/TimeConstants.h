@@ -24,4 +24,7 @@ static const unsigned long msInSecond = 1000;
 static const unsigned long halfSecond = msInSecond / 2;
 static const unsigned long oneSecond = 1 * msInSecond;
 
+static const unsigned long secondsInDay = 24ul * 60 * 60;
+static const unsigned long msInDay = secondsInDay * msInSecond;
+
 #endif
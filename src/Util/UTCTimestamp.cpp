@@ -0,0 +1,106 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UTCTimestamp.h"
+#include "TimeConstants.h"
+
+#include <etl/string.h>
+#include <etl/string_stream.h>
+
+#include <stdint.h>
+
+// Days from the civil calendar's day zero, 0000-03-01, to 2000-01-01.
+static const uint32_t epochDayNumber = 730425;
+static const uint32_t daysIn400Years = 146097;
+
+UTCTimestamp::UTCTimestamp() : seconds(notSet), milliSeconds(0) {
+}
+
+UTCTimestamp::UTCTimestamp(uint32_t days, uint32_t milliSecondOfDay)
+    : seconds(days * secondsInDay + milliSecondOfDay / msInSecond),
+      milliSeconds(milliSecondOfDay % msInSecond) {
+}
+
+// Uses the days from civil algorithm, with years starting in March so that leap days fall at the
+// end of the year. Years before 2000 aren't supported.
+uint32_t UTCTimestamp::daysSinceEpoch(uint16_t year, uint8_t month, uint8_t day) {
+    const uint32_t marchYear = month <= 2 ? year - 1 : year;
+    const uint32_t era = marchYear / 400;
+    const uint32_t yearOfEra = marchYear - era * 400;
+    const uint32_t marchMonth = month > 2 ? month - 3 : month + 9;
+    const uint32_t dayOfYear = (153 * marchMonth + 2) / 5 + day - 1;
+    const uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+    return era * daysIn400Years + dayOfEra - epochDayNumber;
+}
+
+bool UTCTimestamp::isSet() const {
+    return seconds != notSet;
+}
+
+void UTCTimestamp::clear() {
+    seconds = notSet;
+    milliSeconds = 0;
+}
+
+bool UTCTimestamp::sameSecond(const UTCTimestamp &other) const {
+    return seconds == other.seconds;
+}
+
+int32_t UTCTimestamp::milliSecondsSince(const UTCTimestamp &earlier) const {
+    return (int32_t)(seconds - earlier.seconds) * (int32_t)msInSecond +
+           ((int32_t)milliSeconds - (int32_t)earlier.milliSeconds);
+}
+
+bool UTCTimestamp::operator == (const UTCTimestamp &other) const {
+    return seconds == other.seconds && milliSeconds == other.milliSeconds;
+}
+
+bool UTCTimestamp::operator != (const UTCTimestamp &other) const {
+    return !(*this == other);
+}
+
+bool UTCTimestamp::operator < (const UTCTimestamp &other) const {
+    return seconds < other.seconds ||
+           (seconds == other.seconds && milliSeconds < other.milliSeconds);
+}
+
+// The reverse of daysSinceEpoch(), working back from the day to the civil date.
+void UTCTimestamp::formatISO8601(etl::istring &timestampStr) const {
+    const uint32_t dayNumber = seconds / secondsInDay + epochDayNumber;
+    const uint32_t era = dayNumber / daysIn400Years;
+    const uint32_t dayOfEra = dayNumber - era * daysIn400Years;
+    const uint32_t yearOfEra =
+        (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const uint32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const uint32_t marchMonth = (5 * dayOfYear + 2) / 153;
+    const uint32_t day = dayOfYear - (153 * marchMonth + 2) / 5 + 1;
+    const uint32_t month = marchMonth < 10 ? marchMonth + 3 : marchMonth - 9;
+    const uint32_t year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+
+    const uint32_t secondOfDay = seconds % secondsInDay;
+
+    timestampStr.clear();
+    etl::string_stream timestampStream(timestampStr);
+    timestampStream << etl::setfill('0') << etl::setw(4) << year << etl::setw(1) << "-"
+                    << etl::setw(2) << month << etl::setw(1) << "-" << etl::setw(2) << day
+                    << etl::setw(1) << "T" << etl::setw(2) << secondOfDay / 3600
+                    << etl::setw(1) << ":" << etl::setw(2) << secondOfDay / 60 % 60
+                    << etl::setw(1) << ":" << etl::setw(2) << secondOfDay % 60
+                    << etl::setw(1) << "Z";
+}
@@ -0,0 +1,50 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UTC_TIMESTAMP_H
+#define UTC_TIMESTAMP_H
+
+#include <etl/string.h>
+
+#include <stdint.h>
+
+// A UTC time packed as the seconds since the start of 2000 and the milliseconds within the second,
+// so that times from different sentences and sources can be compared and subtracted without
+// looking at their text.
+class UTCTimestamp {
+    private:
+        static const uint32_t notSet = 0xffffffff;
+
+        uint32_t seconds;
+        uint16_t milliSeconds;
+
+    public:
+        UTCTimestamp();
+        UTCTimestamp(uint32_t days, uint32_t milliSecondOfDay);
+        static uint32_t daysSinceEpoch(uint16_t year, uint8_t month, uint8_t day);
+        bool isSet() const;
+        void clear();
+        bool sameSecond(const UTCTimestamp &other) const;
+        int32_t milliSecondsSince(const UTCTimestamp &earlier) const;
+        bool operator == (const UTCTimestamp &other) const;
+        bool operator != (const UTCTimestamp &other) const;
+        bool operator < (const UTCTimestamp &other) const;
+        void formatISO8601(etl::istring &timestampStr) const;
+};
+
+#endif
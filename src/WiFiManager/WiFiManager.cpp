@@ -65,7 +65,7 @@ void WiFiManager::service() {
 }
 
 void WiFiManager::initiateConnection() {
-    logger << logDebugWiFiManager << "Attempting to connect to WiFi network " << wifiSSID << eol;
+    LOG(logDebugWiFiManager) << "Attempting to connect to WiFi network " << wifiSSID << eol;
 
     if (WiFi.begin(wifiSSID, wifiPassword) == WL_CONNECTED) {
         connectionEstablished();
@@ -90,8 +90,8 @@ void WiFiManager::checkForConnectionCompleted() {
 
 void WiFiManager::connectionEstablished() {
     // Pigs in space.....
-    logger << logNotify << "Connected to WiFi network " << wifiSSID << ", IP Address "
-           << WiFi.localIP() << eol;
+    LOG(logNotify) << "Connected to WiFi network " << wifiSSID << ", IP Address "
+                   << WiFi.localIP() << eol;
 
     connectionState = WIFI_CONNECTION_CONNECTED;
     notifyWiFiConnected();
@@ -99,7 +99,7 @@ void WiFiManager::connectionEstablished() {
 
 void WiFiManager::checkConnectionStatus() {
     if (WiFi.status() != WL_CONNECTED) {
-        logger << logNotify << "Lost connection to WiFi network " << wifiSSID << eol;
+        LOG(logNotify) << "Lost connection to WiFi network " << wifiSSID << eol;
         notifyWiFiDisconnected();
         initiateConnection();
     }
@@ -187,7 +187,7 @@ void WiFiManager::checkFirmwareVersion() {
         }
     }
 
-    logger << logDebugWiFiManager << "Firmware version: " << firmwareVersion << eol;
+    LOG(logDebugWiFiManager) << "Firmware version: " << firmwareVersion << eol;
 }
 
 void WiFiManager::firmwareVersionError(const etl::istring &firmwareVersion) {
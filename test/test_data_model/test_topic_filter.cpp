@@ -0,0 +1,161 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "NMEA/NMEALine.h"
+#include "NMEA/NMEAMessage.h"
+#include "NMEADataModelBridge/NMEADataModelBridge.h"
+#include "WiFiManager/WiFiManager.h"
+#include "MQTT/MQTTBroker.h"
+#include "DataModel/DataModel.h"
+#include "DataModel/DataModelSubscriber.h"
+#include "StatsManager/StatsManager.h"
+
+#include <etl/string.h>
+
+#include <unity.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+StatsManager statsManager;
+WiFiManager wifiManager;
+MQTTBroker mqttBroker(statsManager);
+DataModel dataModel(statsManager);
+NMEADataModelBridge nmeaDataModelBridge(statsManager);
+
+// Records the topics published to it, flattened into one space separated string.
+class RecordingSubscriber : public DataModelSubscriber {
+    private:
+        etl::string<16> subscriberName;
+
+    public:
+        char topics[1024];
+
+        RecordingSubscriber() : subscriberName("test") {
+            topics[0] = 0;
+        }
+
+        virtual void publish(const char *topic, uint16_t topicLength __attribute__((unused)),
+                             const char *value __attribute__((unused)),
+                             bool retainedValue __attribute__((unused))) override {
+            strcat(topics, topic);
+            strcat(topics, " ");
+        }
+
+        virtual const etl::istring &name() const override {
+            return subscriberName;
+        }
+};
+
+// Adds the checksum to the body of a sentence and hands it to the NMEA->Data Model bridge.
+static void bridgeSentence(const char *body) {
+    char sentence[100];
+    uint8_t checksum = 0;
+    for (const char *character = body; *character; character++) {
+        checksum ^= *character;
+    }
+    snprintf(sentence, sizeof(sentence), "$%s*%02X", body, checksum);
+
+    uint8_t lineXOR = 0;
+    for (const char *character = sentence; *character; character++) {
+        lineXOR ^= *character;
+    }
+    NMEALine nmeaLine;
+    nmeaLine.set(sentence, strlen(sentence), lineXOR);
+    TEST_ASSERT_TRUE(nmeaLine.sanityCheck());
+    NMEAMessage *message = parseNMEAMessage(nmeaLine);
+    TEST_ASSERT_NOT_NULL(message);
+    nmeaDataModelBridge.processMessage(message);
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+// A filter level has to match the whole node name, so PRN 1 mustn't pick up PRN 11 beside it.
+void test_filter_level_matches_whole_name() {
+    bridgeSentence("GPGSV,1,1,02,01,45,120,30,11,30,200,25");
+
+    RecordingSubscriber subscriber;
+    TEST_ASSERT_TRUE(dataModel.subscribe("gps/satellites/gps/1/snr", subscriber));
+    TEST_ASSERT_EQUAL_STRING("gps/satellites/gps/1/snr ", subscriber.topics);
+    dataModel.unsubscribeAll(subscriber);
+}
+
+void test_filter_level_prefix_does_not_match() {
+    RecordingSubscriber subscriber;
+    TEST_ASSERT_FALSE(dataModel.subscribe("gps/lat", subscriber));
+    TEST_ASSERT_EQUAL_STRING("", subscriber.topics);
+    dataModel.unsubscribeAll(subscriber);
+}
+
+// A filter naming a satellite that isn't in view yet is kept and bound once it shows up, dropped
+// when it goes, and bound again when it's back in a different slot.
+void test_named_slot_filter_binds_later() {
+    RecordingSubscriber subscriber;
+    TEST_ASSERT_TRUE(dataModel.subscribe("gps/satellites/+/20/snr", subscriber));
+    TEST_ASSERT_EQUAL_STRING("", subscriber.topics);
+
+    bridgeSentence("GPGSV,1,1,03,01,45,120,30,11,30,200,25,20,10,300,18");
+    dataModel.publishPending(subscriber, 0, 0xffffffff);
+    TEST_ASSERT_EQUAL_STRING("gps/satellites/gps/20/snr ", subscriber.topics);
+
+    subscriber.topics[0] = 0;
+    bridgeSentence("GPGSV,1,1,01,11,30,200,25");
+    bridgeSentence("GPGSV,1,1,02,20,10,300,19,11,30,200,25");
+    dataModel.publishPending(subscriber, 0, 0xffffffff);
+    TEST_ASSERT_EQUAL_STRING("gps/satellites/gps/20/snr gps/satellites/gps/20/snr ",
+                             subscriber.topics);
+
+    dataModel.unsubscribe("gps/satellites/+/20/snr", subscriber);
+    subscriber.topics[0] = 0;
+    bridgeSentence("GPGSV,1,1,01,11,30,200,25");
+    bridgeSentence("GPGSV,1,1,02,20,10,300,19,11,30,200,25");
+    dataModel.publishPending(subscriber, 0, 0xffffffff);
+    TEST_ASSERT_EQUAL_STRING("", subscriber.topics);
+    dataModel.unsubscribeAll(subscriber);
+}
+
+// Filters naming a slot's item that there's no room to keep are refused rather than acknowledged.
+void test_named_slot_filters_refused_when_full() {
+    RecordingSubscriber subscriber;
+    char topicFilter[40];
+    unsigned prn;
+    for (prn = 30; prn < 38; prn++) {
+        snprintf(topicFilter, sizeof(topicFilter), "gps/satellites/gps/%u/#", prn);
+        TEST_ASSERT_TRUE(dataModel.subscribe(topicFilter, subscriber));
+    }
+    snprintf(topicFilter, sizeof(topicFilter), "gps/satellites/gps/%u/#", prn);
+    TEST_ASSERT_FALSE(dataModel.subscribe(topicFilter, subscriber));
+    TEST_ASSERT_TRUE(dataModel.subscribe("gps/satellites/gps/inView", subscriber));
+
+    dataModel.unsubscribeAll(subscriber);
+    TEST_ASSERT_TRUE(dataModel.subscribe(topicFilter, subscriber));
+    dataModel.unsubscribeAll(subscriber);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_filter_level_matches_whole_name);
+    RUN_TEST(test_filter_level_prefix_does_not_match);
+    RUN_TEST(test_named_slot_filter_binds_later);
+    RUN_TEST(test_named_slot_filters_refused_when_full);
+    return UNITY_END();
+}
@@ -0,0 +1,126 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Util/Logger.h"
+#include "NMEADataModelBridge/NMEADataModelBridge.h"
+#include "WiFiManager/WiFiManager.h"
+#include "MQTT/MQTTBroker.h"
+#include "DataModel/DataModel.h"
+#include "StatsManager/StatsManager.h"
+
+#include <unity.h>
+
+#include <Stream.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+StatsManager statsManager;
+WiFiManager wifiManager;
+MQTTBroker mqttBroker(statsManager);
+DataModel dataModel(statsManager);
+NMEADataModelBridge nmeaDataModelBridge(statsManager);
+
+// A console that takes nothing until it's opened up, and keeps whatever is written to it.
+class CaptureStream : public Stream {
+    public:
+        int writable;
+        char output[4096];
+        size_t outputLength;
+
+        CaptureStream() : writable(0), outputLength(0) {
+            output[0] = 0;
+        }
+
+        virtual size_t write(uint8_t character) override {
+            return write(&character, 1);
+        }
+
+        virtual size_t write(const uint8_t *buffer, size_t size) override {
+            if (size > sizeof(output) - 1 - outputLength) {
+                size = sizeof(output) - 1 - outputLength;
+            }
+            memcpy(output + outputLength, buffer, size);
+            outputLength += size;
+            output[outputLength] = 0;
+            return size;
+        }
+
+        virtual int availableForWrite() override {
+            return writable;
+        }
+
+        virtual int available() override {
+            return 0;
+        }
+
+        virtual int read() override {
+            return -1;
+        }
+
+        virtual int peek() override {
+            return -1;
+        }
+};
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void test_full_ring_drops_whole_lines() {
+    const unsigned linesLogged = 100;
+    CaptureStream console;
+    Logger testLogger(LOGGER_LEVEL_DEBUG, console);
+
+    for (unsigned line = 0; line < linesLogged; line++) {
+        testLogger << logNotify << "Line " << line << " of the test output" << eol;
+    }
+    console.writable = sizeof(console.output);
+    testLogger.service();
+    testLogger.exportStats(0);
+
+    unsigned linesOutput = 0;
+    const char *lineStart = console.output;
+    const char *lineEnd;
+    while ((lineEnd = strstr(lineStart, "\r\n")) != NULL) {
+        char expected[40];
+        snprintf(expected, sizeof(expected), "Line %u of the test output", linesOutput);
+        TEST_ASSERT_EQUAL_UINT(strlen(expected), lineEnd - lineStart);
+        TEST_ASSERT_EQUAL_INT(0, strncmp(expected, lineStart, lineEnd - lineStart));
+        linesOutput++;
+        lineStart = lineEnd + 2;
+    }
+    TEST_ASSERT_EQUAL_STRING("", lineStart);
+    TEST_ASSERT_TRUE(linesOutput > 0);
+    TEST_ASSERT_TRUE(linesOutput < linesLogged);
+    TEST_ASSERT_EQUAL_UINT32(linesLogged - linesOutput, (uint32_t)sysLogDroppedLines);
+
+    // Once there's room again, lines go out as before.
+    testLogger << logNotify << "After the drops" << eol;
+    testLogger.service();
+    TEST_ASSERT_EQUAL_STRING("After the drops\r\n", lineStart);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_full_ring_drops_whole_lines);
+    return UNITY_END();
+}
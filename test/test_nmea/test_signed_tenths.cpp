@@ -0,0 +1,125 @@
+/*
+ * This file is part of LunaMon (https://github.com/LisaRowell/LunaMon)
+ * Copyright (C) 2021-2023 Lisa Rowell
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "NMEA/NMEALine.h"
+#include "NMEA/NMEAMessage.h"
+#include "NMEADataModelBridge/NMEADataModelBridge.h"
+#include "WiFiManager/WiFiManager.h"
+#include "MQTT/MQTTBroker.h"
+#include "DataModel/DataModel.h"
+#include "DataModel/DataModelSubscriber.h"
+#include "StatsManager/StatsManager.h"
+
+#include <etl/string.h>
+
+#include <unity.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+StatsManager statsManager;
+WiFiManager wifiManager;
+MQTTBroker mqttBroker(statsManager);
+DataModel dataModel(statsManager);
+NMEADataModelBridge nmeaDataModelBridge(statsManager);
+
+// Keeps the last value published to it.
+class LastValueSubscriber : public DataModelSubscriber {
+    private:
+        etl::string<16> subscriberName;
+
+    public:
+        char value[32];
+
+        LastValueSubscriber() : subscriberName("test") {
+            value[0] = 0;
+        }
+
+        virtual void publish(const char *topic __attribute__((unused)),
+                             uint16_t topicLength __attribute__((unused)), const char *value,
+                             bool retainedValue __attribute__((unused))) override {
+            strncpy(this->value, value, sizeof(this->value) - 1);
+            this->value[sizeof(this->value) - 1] = 0;
+        }
+
+        virtual const etl::istring &name() const override {
+            return subscriberName;
+        }
+};
+
+// Adds the checksum to the body of a sentence and hands it to the NMEA->Data Model bridge.
+static void bridgeSentence(const char *body) {
+    char sentence[100];
+    uint8_t checksum = 0;
+    for (const char *character = body; *character; character++) {
+        checksum ^= *character;
+    }
+    snprintf(sentence, sizeof(sentence), "$%s*%02X", body, checksum);
+
+    uint8_t lineXOR = 0;
+    for (const char *character = sentence; *character; character++) {
+        lineXOR ^= *character;
+    }
+    NMEALine nmeaLine;
+    nmeaLine.set(sentence, strlen(sentence), lineXOR);
+    TEST_ASSERT_TRUE(nmeaLine.sanityCheck());
+    NMEAMessage *message = parseNMEAMessage(nmeaLine);
+    TEST_ASSERT_NOT_NULL(message);
+    nmeaDataModelBridge.processMessage(message);
+}
+
+// Bridges the sentence and checks the value that went out on the topic.
+static void checkPublishedValue(const char *expectedValue, const char *topic, const char *body) {
+    LastValueSubscriber subscriber;
+    TEST_ASSERT_TRUE(dataModel.subscribe(topic, subscriber));
+    bridgeSentence(body);
+    nmeaDataModelBridge.service();
+    dataModel.publishPending(subscriber, 0, 0xffffffff);
+    dataModel.unsubscribeAll(subscriber);
+    TEST_ASSERT_EQUAL_STRING(expectedValue, subscriber.value);
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void test_schema_field_keeps_sign_below_one() {
+    checkPublishedValue("-0.5", "water/temperature", "IIMTW,-0.5,C");
+    checkPublishedValue("-12.3", "water/temperature", "IIMTW,-12.3,C");
+    checkPublishedValue("0.5", "water/temperature", "IIMTW,0.5,C");
+}
+
+void test_fixed_point_field_keeps_sign_below_one() {
+    checkPublishedValue("-0.5", "gps/altitude",
+                        "GPGGA,120000.00,4740.0000,N,12220.0000,W,1,08,1.0,-0.5,M,-17.3,M,,");
+}
+
+void test_magnetic_variation_keeps_sign_below_one() {
+    checkPublishedValue("-0.5", "gps/magneticVariation",
+                        "GPRMC,120001.00,A,4740.0000,N,12220.0000,W,0.0,0.0,010124,0.5,E,A");
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_schema_field_keeps_sign_below_one);
+    RUN_TEST(test_fixed_point_field_keeps_sign_below_one);
+    RUN_TEST(test_magnetic_variation_keeps_sign_below_one);
+    return UNITY_END();
+}